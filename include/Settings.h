@@ -14,6 +14,7 @@
 #define FRAME_RATE 60
 #define MAX_GRAPHS 8
 #define MAX_BARS 10000
+#define FRAME_ARENA_SIZE (64 * 1024) // Initial size of the per-frame arena, grows to the peak use
 
 #define PRODUCTION 0 // Set to 1 for production build, 0 for development
 
@@ -28,6 +29,7 @@
 #include <assert.h>
 #include <math.h>
 #include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
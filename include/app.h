@@ -22,6 +22,8 @@ struct App {
     List* stack; /** A stack of frames */
     Theme* theme; /** The style theme of the app */
     ResourceManager* manager; /** The resource manager */
+    Arena* frame_arena; /** Transient allocations, reset at the end of every main loop iteration */
+    Profiler* profiler; /** Frame-time profiler, its overlay is toggled with F3 */
 
     bool running; /** Application running state */
     bool frameChanged; /** Flag indicating if the frame has changed */
@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2025 Torisutan
+ * ALl rights reserved
+ */
+
+#pragma once
+
+#include "Settings.h"
+
+/** @brief Alignment of every allocation returned by an Arena. */
+#define ARENA_ALIGNMENT 16
+
+/**
+ * @struct ArenaBlock
+ * @brief One contiguous block of arena memory.
+ *
+ * - next: block allocated before this one, or NULL.
+ * - capacity: number of usable bytes in \p data.
+ * - used: number of bytes already handed out.
+ * - data: the memory itself.
+ */
+struct ArenaBlock {
+    ArenaBlock* next;
+    size_t capacity;
+    size_t used;
+    _Alignas(ARENA_ALIGNMENT) unsigned char data[];
+};
+
+/**
+ * @struct Arena
+ * @brief Bump allocator for short-lived allocations, released all at once.
+ *
+ * Allocating only moves an offset forward; nothing is freed individually.
+ * Arena_reset drops everything in O(1). When a block is full a new one is
+ * chained, and the next reset merges them into one block big enough for the
+ * whole peak, so a steady workload ends up never calling malloc.
+ * Not thread safe: an arena belongs to the thread that resets it.
+ *
+ * - head: block currently allocated from, older blocks follow through next.
+ * - peak: largest number of bytes used between two resets.
+ */
+struct Arena {
+    ArenaBlock* head;
+    size_t peak;
+};
+
+/**
+ * @brief Create an arena with a first block of \p capacity bytes.
+ *
+ * @param capacity Initial capacity in bytes.
+ * @return Pointer to the new Arena, or NULL on allocation failure.
+ */
+Arena* Arena_create(size_t capacity);
+
+/**
+ * @brief Destroy an arena and every block it owns.
+ *
+ * @param arena Arena to destroy. Safe to pass NULL.
+ */
+void Arena_destroy(Arena* arena);
+
+/**
+ * @brief Allocate \p size bytes aligned on ARENA_ALIGNMENT.
+ *
+ * The memory is not zeroed and stays valid until the next Arena_reset.
+ *
+ * @param arena Arena to allocate from.
+ * @param size Number of bytes.
+ * @return Pointer to the memory, or NULL on allocation failure.
+ */
+void* Arena_alloc(Arena* arena, size_t size);
+
+/**
+ * @brief Copy a string into the arena.
+ *
+ * @param arena Arena to allocate from.
+ * @param str Null-terminated string to copy.
+ * @return Arena-owned copy, or NULL on failure.
+ */
+char* Arena_strdup(Arena* arena, const char* str);
+
+/**
+ * @brief printf-style formatting into arena memory.
+ *
+ * @param arena Arena to allocate from.
+ * @param format printf-style format string.
+ * @param ... Format arguments.
+ * @return Arena-owned formatted string, or NULL on failure.
+ */
+char* Arena_format(Arena* arena, const char* format, ...);
+
+/**
+ * @brief Release every allocation made since the last reset.
+ *
+ * @param arena Arena to reset.
+ */
+void Arena_reset(Arena* arena);
+
+/**
+ * @brief Number of bytes currently allocated from the arena.
+ *
+ * @param arena Arena to query.
+ * @return Bytes in use across all blocks.
+ */
+size_t Arena_used(const Arena* arena);
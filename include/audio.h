@@ -7,6 +7,161 @@
 
 #include "Settings.h"
 
+/** @brief Sample rate requested when opening the audio output, in Hz. */
+#define AUDIO_SAMPLE_RATE 44100
+/** @brief Peak amplitude of generated tones in 16-bit samples. */
+#define AUDIO_AMPLITUDE 28000
+
+/** @brief Tones each graph can queue before new ones are dropped, must be a power of two. */
+#define AUDIO_EVENT_QUEUE_SIZE 256
+/** @brief Tones sounding at the same time, the most faded one is replaced when all are busy. */
+#define AUDIO_VOICES 32
+/** @brief Tones started per graph for each mixed buffer, extra sort steps are skipped. */
+#define AUDIO_TONES_PER_MIX 4
+/** @brief Duration of a tone, envelope included. */
+#define AUDIO_TONE_MS 60
+/** @brief Waveform of the sort tones. */
+#define AUDIO_TONE_WAVEFORM WAVEFORM_SINE
+/** @brief Peak amplitude of a single sort tone in 16-bit samples. */
+#define AUDIO_TONE_AMPLITUDE 3000
+/** @brief Pitch of the smallest bar. */
+#define AUDIO_MIN_FREQUENCY 120.f
+/** @brief Pitch of the largest bar. */
+#define AUDIO_MAX_FREQUENCY 1200.f
+/** @brief Pitch of the tone confirming that the sort sounds are turned on. */
+#define AUDIO_SOUND_ON_FREQUENCY 880
+/** @brief Pitch of the tone confirming that the sort sounds are turned off. */
+#define AUDIO_SOUND_OFF_FREQUENCY 440
+/** @brief Duration of the sound on / off tones. */
+#define AUDIO_TOGGLE_TONE_MS 120
+
+/**
+ * @struct AudioEventQueue
+ * @brief Single-producer single-consumer queue of tones from one graph to the audio callback.
+ *
+ * - frequencies: pitch of each queued tone, in Hz.
+ * - head: number of tones ever pushed, only written by the producer.
+ * - tail: number of tones ever consumed, only written by the audio callback.
+ * - producer: taken with a try-lock so that several threads sorting the same
+ *   graph never share the producer side; a thread that fails drops its tone.
+ */
+struct AudioEventQueue {
+    float frequencies[AUDIO_EVENT_QUEUE_SIZE];
+    SDL_atomic_t head;
+    SDL_atomic_t tail;
+    SDL_SpinLock producer;
+};
+
+/**
+ * @struct AudioVoice
+ * @brief One tone being synthesized, only touched by the audio callback.
+ *
+ * - active: whether the voice is sounding or waiting for its delay.
+ * - oscillator: wavetable oscillator producing the tone.
+ * - delay: samples to wait before starting, spreads tones over a buffer.
+ * - age / length: samples played and total samples of the tone.
+ */
+struct AudioVoice {
+    bool active;
+    Oscillator oscillator;
+    int delay;
+    int age;
+    int length;
+};
+
+/**
+ * @brief Render a tone into a new chunk.
+ *
+ * Rendered at the sample rate and channel count of the open mixer device,
+ * the same sample on every channel. The chunk owns its samples, free it with
+ * Mix_FreeChunk. For tones played repeatedly prefer ResourceManager_getTone,
+ * which renders each one once.
+ *
+ * @param waveform Shape of the tone.
+ * @param frequency Frequency in Hz.
+ * @param duration_ms Duration in milliseconds.
+ * @return New chunk, or NULL on failure.
+ */
+Mix_Chunk* Audio_createTone(Waveform waveform, int frequency, int duration_ms);
+
+/**
+ * @brief Render a sine tone into a new chunk, see Audio_createTone.
+ */
 Mix_Chunk* Audio_createNoise(int frequency, int duration_ms);
+
+/**
+ * @brief Play a chunk on a free mixer channel without waiting for it to end.
+ *
+ * The chunk is not freed and must stay alive while it plays.
+ *
+ * @param chunk Chunk to play.
+ * @param volume Volume from 0 to MIX_MAX_VOLUME.
+ * @param loop true to repeat until the channel is halted.
+ */
 void Audio_play(Mix_Chunk* chunk, int volume, bool loop);
-void Audio_playSweepingNoise(int start_freq, int end_freq, int duration_ms);
\ No newline at end of file
+
+/**
+ * @brief Render a sine sweeping linearly from one frequency to another into a new chunk.
+ *
+ * Rendered for the open mixer device like Audio_createTone. The chunk owns
+ * its samples, free it with Mix_FreeChunk.
+ *
+ * @param start_freq Frequency at the start, in Hz.
+ * @param end_freq Frequency at the end, in Hz.
+ * @param duration_ms Duration in milliseconds.
+ * @return New chunk, or NULL on failure.
+ */
+Mix_Chunk* Audio_createSweep(int start_freq, int end_freq, int duration_ms);
+
+/**
+ * @brief Play a sweep on the mixer output without waiting for it to end.
+ *
+ * Goes through the device opened by Mix_OpenAudio. The sweep is kept until
+ * the next one replaces it, halting it if still playing, or until
+ * Audio_stopSonification.
+ *
+ * @param start_freq Frequency at the start, in Hz.
+ * @param end_freq Frequency at the end, in Hz.
+ * @param duration_ms Duration in milliseconds.
+ */
+void Audio_playSweepingNoise(int start_freq, int end_freq, int duration_ms);
+
+/**
+ * @brief Hook the sort synthesizer into the SDL_mixer output.
+ *
+ * Must be called after Mix_OpenAudio. The synthesizer stays silent until
+ * enabled with Audio_setSonification.
+ *
+ * @return true on success, false if the audio output cannot be used.
+ */
+bool Audio_startSonification();
+
+/**
+ * @brief Unhook the sort synthesizer and free the last sweep. Must be called before Mix_CloseAudio.
+ */
+void Audio_stopSonification();
+
+/**
+ * @brief Enable or disable the sound of the sorts.
+ *
+ * @param enabled true to play a tone for each sort step.
+ */
+void Audio_setSonification(bool enabled);
+
+/**
+ * @brief Whether sort steps currently play tones.
+ *
+ * @return true if enabled with Audio_setSonification.
+ */
+bool Audio_isSonificationEnabled();
+
+/**
+ * @brief Queue a tone for a sort step of a graph.
+ *
+ * Safe to call from any sort thread, it never blocks or allocates: when the
+ * queue is full or the sound is disabled the tone is dropped.
+ *
+ * @param graph_index Index of the graph, selects its queue.
+ * @param value Position of the bar value between 0 (smallest) and 1 (largest), mapped to the pitch.
+ */
+void Audio_pushTone(int graph_index, float value);
@@ -24,8 +24,8 @@ struct ColumnGraph {
     /** @brief Number of bars currently present in the graph. */
     int bars_count;
 
-    /** @brief List of ColumnGraphBar\* contained by the graph. */
-    List* bars;
+    /** @brief Contiguous array of ColumnGraphBar\* contained by the graph. */
+    Vector* bars;
 
     /** @brief Flex container used to layout bar elements. */
     FlexContainer* container;
@@ -60,9 +60,21 @@ struct ColumnGraph {
     /** @brief Container used to render the graph statistics UI. */
     Container* stats_container;
 
+    /** @brief Stats lines owned by stats_container (time, comparisons, swaps, reads and writes), updated in place. */
+    Text* stats_texts[4];
+
+    /** @brief Graph bounds stats_container was laid out for; it is rebuilt when they change. */
+    SDL_FRect stats_bounds;
+
+    /** @brief Sort type shown in the stats_container title when it was built. */
+    ListSortType stats_sort_type;
+
     /** @brief Current list sort algorithm used for sorting the bars. */
     ListSortType sort_type;
 
+    /** @brief Gap sequence used when sort_type is LIST_SORT_TYPE_SHELL. */
+    ShellGapSequence shell_gaps;
+
     /** @brief Data type of the graph values (integer or string). */
     ColumnGraphType type;
 
@@ -116,7 +128,8 @@ void ColumnGraph_destroy(ColumnGraph* graph);
 /**
  * @brief Update per-frame graph state.
  *
- * Typically updates statistics, timers and any dynamic UI elements.
+ * Updates the sort time and the stats texts in place. The stats container is
+ * only rebuilt when the graph moves, is resized or changes sort type.
  *
  * @param graph Pointer to the ColumnGraph to update.
  */
@@ -196,6 +209,32 @@ void ColumnGraph_sortGraph(ColumnGraph* graph, SDL_mutex* gm, DelayFunc delay_fu
  */
 void ColumnGraph_removeHovering(ColumnGraph* graph);
 
+/**
+ * @brief Return the bar under the given point, if any.
+ *
+ * Bars occupy equal-width slots, so the bar index is derived directly from
+ * the x offset instead of testing every bar: the cost is O(1) whatever the
+ * number of bars.
+ *
+ * @param graph Pointer to the ColumnGraph.
+ * @param x Point x coordinate in screen space.
+ * @param y Point y coordinate in screen space.
+ * @return Pointer to the bar under the point, or NULL if the point hits no bar.
+ */
+ColumnGraphBar* ColumnGraph_getBarAt(ColumnGraph* graph, float x, float y);
+
+/**
+ * @brief Update the hover state of the graph for a new mouse position.
+ *
+ * Removes the previous hover (calling offHover) and highlights the bar under
+ * the mouse (calling onHover). Ignored while a sort is in progress.
+ *
+ * @param graph Pointer to the ColumnGraph.
+ * @param x Mouse x coordinate in screen space.
+ * @param y Mouse y coordinate in screen space.
+ */
+void ColumnGraph_handleMouseMotion(ColumnGraph* graph, float x, float y);
+
 /**
  * @brief Recreate/render bars to fit a new width / height.
  *
@@ -245,6 +284,14 @@ Color** ColumnGraph_getColors(ColumnGraph* graph, int* out_len);
  */
 void ColumnGraph_setSortType(ColumnGraph* graph, ListSortType sort_type);
 
+/**
+ * @brief Set the gap sequence used by Shell sort.
+ *
+ * @param graph Graph to update.
+ * @param shell_gaps ShellGapSequence to apply.
+ */
+void ColumnGraph_setShellGaps(ColumnGraph* graph, ShellGapSequence shell_gaps);
+
 /**
  * @brief Remove and destroy all bars from the graph.
  *
@@ -310,6 +357,16 @@ void ColumnGraphBar_destroy(ColumnGraphBar* bar);
  */
 void ColumnGraphBar_setValue(ColumnGraphBar* bar, void* value);
 
+/**
+ * @brief Switch a bar between its own color and the graph hover color.
+ *
+ * The bar background is overwritten in place, no color is allocated.
+ *
+ * @param bar Pointer to the ColumnGraphBar.
+ * @param highlighted true to use the hover color, false to restore the bar color.
+ */
+void ColumnGraphBar_setHighlighted(ColumnGraphBar* bar, bool highlighted);
+
 /**
  * @brief Compare two ColumnGraphBar instances for sorting.
  *
@@ -344,7 +401,7 @@ char* ColumnGraph_getStyleName(ColumnGraphStyle style);
  * @brief Return the hover color associated with the given style.
  *
  * @param style ColumnGraphStyle to query.
- * @return Color\* used to highlight hovered bars (ownership per implementation).
+ * @return Pointer to a static Color used to highlight hovered bars; must not be freed.
  */
 Color* ColumnGraph_getHoverColor(ColumnGraphStyle style);
 
@@ -20,13 +20,20 @@
         Box* box;
 
         /**
-         * @brief List of child elements contained within this container
+         * @brief Vector of child elements contained within this container
          *
-         * The list can't be NULL, but can be empty.
-         * All the elements in the list are of type Element*.
+         * The vector can't be NULL, but can be empty.
+         * All the elements in the vector are of type Element*.
          * The positions of the children are NOT relative to the container's position.
          */
-        List* children;
+        Vector* children;
+
+        /**
+         * @brief Index of the children by id (string keys, Element* values)
+         *
+         * Maintained by Container_addChild/Container_removeChild, used by Container_getChildById.
+         */
+        Map* children_by_id;
 
         /**
          * @brief Pointer to the parent object of the container
@@ -35,6 +42,32 @@
          * Can also be used for going back references in event handlers.
          */
         void* parent;
+
+        /**
+         * @brief Cached rendering of the box and children, NULL until first rendered with caching on
+         *
+         * Only valid when cache_layer is true. Children must stay inside the box, anything
+         * drawn outside of it is clipped from the layer.
+         */
+        SDL_Texture* layer;
+
+        /**
+         * @brief If true, the subtree is rendered once into layer and then blitted every frame
+         */
+        bool cache_layer;
+
+        /**
+         * @brief Set when the cached layer is stale and must be rendered again
+         *
+         * Adding/removing a child, resizing or a render target/device reset marks the layer dirty automatically.
+         * Any other visual change of a child must be reported with Container_markDirty.
+         */
+        bool layer_dirty;
+
+        /**
+         * @brief Set on SDL_RENDER_DEVICE_RESET, the layer texture is recreated on the next render
+         */
+        bool layer_lost;
     };
 
 /**
@@ -78,6 +111,15 @@ void Container_addChild(Container* container, Element* child);
  */
 void Container_removeChild(Container* container, Element* child);
 
+/**
+ * @brief Find a direct child element by its id in O(1)
+ *
+ * @param container The Container instance
+ * @param id The id given to the child element
+ * @return The child Element, or NULL if no child has this id
+ */
+Element* Container_getChildById(Container* container, const char* id);
+
 /**
  * @brief Render the container and its children
  *
@@ -88,6 +130,29 @@ void Container_removeChild(Container* container, Element* child);
  */
 void Container_render(Container* container, SDL_Renderer* renderer);
 
+/**
+ * @brief Enable or disable the render-to-texture cache of the container
+ *
+ * When enabled, the container renders its subtree into a texture the first time,
+ * then only copies that texture each frame until it is marked dirty. Meant for
+ * mostly static panels, where it replaces dozens of draw calls with one copy.
+ * While enabled, an SDL event watch marks the layer dirty when render targets are reset.
+ *
+ * @param container - The Container instance
+ * @param enabled - Whether the layer cache is used
+ */
+void Container_setCacheLayer(Container* container, bool enabled);
+
+/**
+ * @brief Mark the cached layer of the container as stale
+ *
+ * The subtree is rendered again into the layer on the next Container_render.
+ * Does nothing visible when the cache is disabled.
+ *
+ * @param container - The Container instance
+ */
+void Container_markDirty(Container* container);
+
 /**
  * @brief Update the container and its children
  *
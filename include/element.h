@@ -180,7 +180,7 @@ void Element_destroy(Element* element);
  *
  * @param list - The list of Elements to destroy.
  */
-void Element_destroyList(List* list);
+void Element_destroyList(Vector* list);
 
 /**
  * @brief Renders the Element using the provided SDL_Renderer.
@@ -219,7 +219,7 @@ void Element_unfocus(Element* element);
  * @param list - The list of Elements to render.
  * @param renderer - The SDL_Renderer to use for rendering.
  */
-void Element_renderList(List* list, SDL_Renderer* renderer);
+void Element_renderList(Vector* list, SDL_Renderer* renderer);
 
 /**
  * @brief Updates a list of Elements.
@@ -228,7 +228,7 @@ void Element_renderList(List* list, SDL_Renderer* renderer);
  *
  * @param list - The list of Elements to update.
  */
-void Element_updateList(List* list);
+void Element_updateList(Vector* list);
 
 /**
  * @brief Focuses all focusable elements in the list.
@@ -237,25 +237,49 @@ void Element_updateList(List* list);
  *
  * @param list - The list of Elements to focus.
  */
-void Element_focusList(List* list);
+void Element_focusList(Vector* list);
 
 /**
  * @brief Unfocuses all focusable elements in the list.
  *
  * @param list - The list of Elements to unfocus.
  */
-void Element_unfocusList(List* list);
+void Element_unfocusList(Vector* list);
 
 /**
- * @brief Retrieves an Element from the list by its unique identifier.
+ * @brief Appends an Element to a list and registers its id in the list's index.
  *
- * If multiple elements have the same id, the first one found is returned.
+ * Elements without id are only appended. If another element already uses the
+ * same id, the first one registered keeps the index entry.
  *
- * @param list - The list of Elements to search.
+ * @param list - The list of Elements to append to.
+ * @param index - The id -> Element map kept alongside \p list (string keys).
+ * @param element - The Element to append.
+ */
+void Element_pushToList(Vector* list, Map* index, Element* element);
+
+/**
+ * @brief Removes an Element from a list and from the list's id index.
+ *
+ * The element is not destroyed.
+ *
+ * @param list - The list of Elements to remove from.
+ * @param index - The id -> Element map kept alongside \p list.
+ * @param element - The Element to remove.
+ */
+void Element_removeFromList(Vector* list, Map* index, Element* element);
+
+/**
+ * @brief Retrieves an Element by its unique identifier in O(1).
+ *
+ * The index must have been filled with Element_pushToList (or Container_addChild).
+ * If multiple elements have the same id, the first one added is returned.
+ *
+ * @param index - The id -> Element map to search.
  * @param id - The unique identifier of the Element to find.
  * @return A pointer to the Element with the specified id, or NULL if not found.
  */
-Element* Element_getById(List* list, const char* id);
+Element* Element_getById(Map* index, const char* id);
 
 /**
  * @brief Converts an ElementType to its string representation.
@@ -14,8 +14,11 @@
  * a reference to the application context, and simple pagination state.
  */
 struct HelpFrame {
-    /** @brief List of elements composing the help pages (List\* of Element\*). */
-    List* elements;
+    /** @brief Elements composing the help pages (Vector\* of Element\*). */
+    Vector* elements;
+
+    /** @brief Index of the page elements by id, kept in sync with elements. */
+    Map* elements_by_id;
 
     /** @brief Pointer to the global application context (renderer, input, resources). */
     App *app;
@@ -7,28 +7,33 @@
 
 #include "Settings.h"
 
-#define MAX_KEY_DOWN 256
+/** @brief Number of 64-bit words needed to hold one bit per SDL scancode. */
+#define INPUT_KEY_WORDS ((SDL_NUM_SCANCODES + 63) / 64)
 
 /**
  * @struct Input
  * @brief Tracks current input state and registered event handlers.
  *
- * - keysDown: list of currently pressed SDL_Scancode values.
+ * - keysDown: bitset of currently held SDL_Scancode values.
+ * - keysPressed / keysReleased: bitsets of scancodes that went down / up during
+ *   the last Input_update; reset at the start of every update.
  * - lastPressed: last SDL_Scancode pressed.
  * - keyEventHandlers: map from SDL_Scancode to List of EventHandler.
  * - eventHandlers: map from SDL_Event type (Uint32) to List of EventHandler.
- * - mousePos: current mouse position.
+ * - mouse_x / mouse_y: current mouse position, updated in place on every motion event.
  * - mouse_left / mouse_right: current mouse button states.
  * - shift / ctrl / alt: modifier key states.
  * - esc: whether escape is pressed.
  * - quit: whether a quit event was received.
  */
 struct Input {
-    List* keysDown;
+    Uint64 keysDown[INPUT_KEY_WORDS];
+    Uint64 keysPressed[INPUT_KEY_WORDS];
+    Uint64 keysReleased[INPUT_KEY_WORDS];
     SDL_Scancode lastPressed;
     Map* keyEventHandlers;
     Map* eventHandlers;
-    Position* mousePos;
+    float mouse_x, mouse_y;
     bool mouse_left, mouse_right;
     bool shift, ctrl, alt;
     bool esc;
@@ -83,10 +88,30 @@ void Input_update(Input* input);
  *
  * @param input Pointer to Input instance.
  * @param key SDL_Scancode to query.
- * @return true if the key is in the keysDown list, false otherwise.
+ * @return true if the key is set in the keysDown bitset, false otherwise.
  */
 bool Input_keyDown(Input* input, SDL_Scancode key);
 
+/**
+ * @brief Check whether a given key went down during the last Input_update.
+ *
+ * Key auto-repeat does not count as a new press.
+ *
+ * @param input Pointer to Input instance.
+ * @param key SDL_Scancode to query.
+ * @return true if the key was pressed this frame, false otherwise.
+ */
+bool Input_keyPressed(Input* input, SDL_Scancode key);
+
+/**
+ * @brief Check whether a given key was released during the last Input_update.
+ *
+ * @param input Pointer to Input instance.
+ * @param key SDL_Scancode to query.
+ * @return true if the key was released this frame, false otherwise.
+ */
+bool Input_keyReleased(Input* input, SDL_Scancode key);
+
 /**
  * @brief Check whether the mouse is inside a given rectangle.
  *
@@ -151,11 +151,12 @@ char* InputBox_getString(InputBox* input_box);
 /**
  * @brief Return the formatted (possibly masked) string used for display.
  *
- * If password_mode is enabled, this returns a masked copy; otherwise returns
- * the internal string pointer.
+ * If password_mode is enabled, this returns a masked copy allocated in the
+ * frame arena (valid until the end of the frame); otherwise returns the
+ * internal string pointer. The result must never be freed.
  *
  * @param input_box Pointer to the InputBox.
- * @return Pointer to either the internal string or a newly allocated masked string.
+ * @return Pointer to either the internal string or a frame-lived masked string.
  */
 char* InputBox_getFormattedString(InputBox* input_box);
 
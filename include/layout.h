@@ -80,7 +80,7 @@ struct FlexItem {
  * @struct FlexContainer
  * @brief Container that lays out multiple FlexItem entries.
  *
- * - items: List\* of FlexItem\* elements.
+ * - items: Vector\* of FlexItem\* elements.
  * - direction: main axis direction.
  * - justify_content: distribution along the main axis.
  * - align_items: alignment along the cross axis.
@@ -89,7 +89,7 @@ struct FlexItem {
  * - width, height: available size for layout.
  */
 struct FlexContainer {
-    List* items;
+    Vector* items;
     FlexDirection direction;
     FlexJustify justify_content;
     FlexAlign align_items;
@@ -7,6 +7,8 @@
 
 #include "Settings.h"
 
+#define LIST_NODES_PER_CHUNK 16
+
 /**
  * @struct ListNode
  * @brief Node used by the doubly-linked circular List.
@@ -27,10 +29,12 @@ struct ListNode {
  *
  * - head: sentinel node whose next/prev link the list contents.
  * - size: number of elements currently stored in the list.
+ * - nodes: slab the nodes are allocated from, emptied in one go by List_clear.
  */
 struct List {
     ListNode* head;
     size_t size;
+    Pool* nodes;
 };
 
 /**
@@ -80,9 +84,10 @@ void List_destroy(List* list);
 void List_destroyWitValues(List* list, void (*destroyValueFunc)(void* value));
 
 /**
- * @brief Remove and free all nodes from the list but keep the list itself.
+ * @brief Remove all nodes from the list but keep the list itself.
  *
- * Leaves the sentinel head node and resets size to 0.
+ * Leaves the sentinel head node and resets size to 0. The nodes are returned to
+ * the list's slab in bulk, so refilling the list does not allocate again.
  *
  * @param list Pointer to List to clear.
  */
@@ -15,7 +15,54 @@ enum LogLevel {
     LOG_LEVEL_FATAL
 };
 
-void log_message(LogLevel level, const char* format, ...);
+/** @brief Number of messages the queue holds before new ones are dropped, must be a power of two. */
+#define LOG_QUEUE_SIZE 1024
+/** @brief Maximum length of a formatted message, longer ones are truncated. */
+#define LOG_MESSAGE_SIZE 1096
+
+/**
+ * @brief Lowest level compiled in, calls below it cost nothing.
+ *
+ * Debug messages are only kept in development builds (PRODUCTION == 0).
+ */
+#ifndef LOG_MIN_LEVEL
+#  if !defined(PRODUCTION) || PRODUCTION == 1
+#    define LOG_MIN_LEVEL LOG_LEVEL_INFO
+#  else
+#    define LOG_MIN_LEVEL LOG_LEVEL_DEBUG
+#  endif
+#endif
+
+/**
+ * @struct LogRecord
+ * @brief One slot of the logger queue.
+ *
+ * - sequence: slot state for the queue, tells whether it is free or ready to print.
+ * - level / time / message: the message, formatted by the thread that logged it.
+ */
+struct LogRecord {
+    SDL_atomic_t sequence;
+    LogLevel level;
+    time_t time;
+    char message[LOG_MESSAGE_SIZE];
+};
+
+#define log_message(level, ...) \
+    do { if ((level) >= LOG_MIN_LEVEL) log_write(level, __VA_ARGS__); } while (0)
+void log_write(LogLevel level, const char* format, ...);
 #define error(msg, ...) log_error(__FILE__, __LINE__, __func__, msg, ##__VA_ARGS__)
 void log_error(const char* file, int line, const char* func, const char* error, ...);
-void test_all_log();
\ No newline at end of file
+void test_all_log();
+
+/**
+ * @brief Start the background thread printing the messages.
+ *
+ * Until then, and after Logger_stop, messages are printed on the calling thread.
+ * Needs SDL to be initialized.
+ */
+void Logger_start();
+
+/**
+ * @brief Print every pending message and stop the background thread.
+ */
+void Logger_stop();
@@ -7,6 +7,9 @@
 
 #include "Settings.h"
 
+/** @brief Number of sort passes listed in the graph info dialog, the others are summed up in one line. */
+#define MAIN_FRAME_INFO_MAX_PASSES 8
+
 /**
  * @struct MainFrame
  * @brief Represents the main application UI frame and state.
@@ -16,8 +19,11 @@
  * such as currently selected graph, sorting flags and animation parameters.
  */
 struct MainFrame {
-    /** List of top-level UI Element objects currently rendered. */
-    List* elements;
+    /** Vector of top-level UI Element objects currently rendered. */
+    Vector* elements;
+
+    /** Index of the top-level elements by id, kept in sync with elements. */
+    Map* elements_by_id;
 
     /** Back-reference to the global App context (renderer, window, input, resources). */
     App* app;
@@ -82,6 +88,12 @@ struct MainFrame {
     /** True when the mouse is hovering the help icon in settings. */
     bool hovered_help;
 
+    /** True while the mouse is over the settings panel, so leaving it repaints the dropped hover states. */
+    bool settings_hovered;
+
+    /** True while an input box of the settings panel was being edited on the previous update. */
+    bool settings_editing;
+
     /** If true, automatic delay computation is used during visualized sorting. */
     bool automatic_delay;
 
@@ -102,6 +114,12 @@ struct MainFrame {
 
     /** Last known window height used to detect and revert invalid resizes during sort. */
     int last_height;
+
+    /** Set when the settings panel must be rebuilt from scratch (e.g. after a window resize). */
+    bool layout_dirty;
+
+    /** Set when values shown in the settings panel changed and must be refreshed in place. */
+    bool settings_dirty;
 };
 
 /**
@@ -152,8 +170,9 @@ void MainFrame_render(SDL_Renderer* renderer, MainFrame* self);
 /**
  * @brief Update callback used by the application's frame system.
  *
- * Advances animations, updates timers, updates each ColumnGraph (with locking)
- * and updates UI elements.
+ * Rebuilds or refreshes the settings panel when it was marked dirty, advances
+ * animations, updates timers, updates each ColumnGraph (with locking) and
+ * updates UI elements.
  *
  * @param self MainFrame instance to update (must not be NULL).
  */
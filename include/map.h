@@ -7,42 +7,48 @@
 
 #include "Settings.h"
 
+#define MAP_INITIAL_CAPACITY 16
+
 /**
  * @struct MapNode
- * @brief Node stored in the doubly-linked list backing the map.
+ * @brief Slot of the open-addressing table backing the map.
  *
- * This node stores a key/value pair and pointers to the next and previous nodes.
+ * Stores a key/value pair together with its cached hash and its probe distance.
  * Keys and values are stored as void\* and interpreted by the caller.
  */
 struct MapNode {
-    void* key;    /**< Pointer to the key (or C-string if map->is_key_string is true). */
-    void* value;  /**< Pointer to the associated value. */
-    MapNode* next; /**< Next node in the circular list. */
-    MapNode* prev; /**< Previous node in the circular list. */
+    void* key;      /**< Pointer to the key (or C-string if map->is_key_string is true). */
+    void* value;    /**< Pointer to the associated value. */
+    Uint32 hash;    /**< Cached hash of the key, avoids re-hashing strings when growing. */
+    Uint32 probe;   /**< Distance from the home slot plus one; 0 marks an empty slot. */
 };
 
 /**
  * @struct Map
- * @brief Map container implemented as a circular doubly-linked list with a root sentinel.
+ * @brief Hash map using open addressing with robin-hood probing.
  *
+ * The slot count is always a power of two and the table grows before it gets
+ * more than 3/4 full, so lookups touch a short, contiguous run of slots.
  * The map does not perform deep copies of keys or values; the caller owns the memory.
- * The is_key_string flag enables string equality checks for keys instead of pointer equality.
+ * The is_key_string flag enables string hashing/equality for keys instead of pointer identity.
  */
 struct Map {
-    MapNode* root;       /**< Sentinel root node. root->next == first, root->prev == last. */
+    MapNode* nodes;      /**< Slot array of \p capacity entries. */
+    size_t capacity;     /**< Number of slots (power of two). */
     size_t size;         /**< Number of key/value entries currently stored. */
-    bool is_key_string;  /**< If true, keys are compared as C-strings. */
+    bool is_key_string;  /**< If true, keys are hashed and compared as C-strings. */
 };
 
 /**
  * @struct MapIterator
  * @brief Simple iterator for traversing a Map in forward direction.
  *
- * The iterator maintains a reference to the map's root sentinel and the current node.
+ * Entries are visited in slot order, which is unrelated to insertion order.
  */
 struct MapIterator {
-    MapNode* root;    /**< The map sentinel node used to detect end of iteration. */
-    MapNode* current; /**< Current node; starts at root and advances with MapIterator_next. */
+    Map* map;         /**< The iterated map. */
+    MapNode* current; /**< Current slot; NULL before the first call to MapIterator_next. */
+    size_t next;      /**< Index of the first slot not yet examined. */
 };
 
 /**
@@ -56,7 +62,7 @@ Map* Map_create(bool is_key_string);
 /**
  * @brief Destroy a Map and free associated memory.
  *
- * The function frees all internal nodes and the Map structure itself. It does not
+ * The function frees the slot table and the Map structure itself. It does not
  * free keys or values stored in the map; the caller is responsible for that if needed.
  *
  * @param map Pointer to the Map to destroy (may be NULL).
@@ -76,7 +82,7 @@ void Map_clear(Map* map);
  * @brief Insert or replace a key/value pair in the Map.
  *
  * If the key already exists (according to the map's key comparison mode), the value
- * is replaced. Otherwise a new node is appended to the list.
+ * is replaced. Otherwise the pair is inserted, growing the table if needed.
  *
  * @param map Pointer to the Map.
  * @param key Pointer to the key (or C-string if is_key_string is true).
@@ -96,6 +102,8 @@ void* Map_get(Map* map, void* key);
 /**
  * @brief Find the MapNode containing the given key.
  *
+ * The returned slot stays valid until the next insertion or removal.
+ *
  * @param map Pointer to the Map.
  * @param key Key to locate.
  * @return Pointer to the MapNode if found, otherwise NULL.
@@ -125,7 +133,7 @@ bool Map_containsValue(Map* map, void* value);
 /**
  * @brief Remove the entry with the specified key from the Map.
  *
- * The node is freed but the key and value pointers are not freed.
+ * The key and value pointers are not freed.
  *
  * @param map Pointer to the Map.
  * @param key Key of the entry to remove.
@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2025 Torisutan
+ * All rights reserved
+ */
+
+#pragma once
+
+#include "Settings.h"
+
+/** @brief Log2 of the number of samples in one period of a wavetable. */
+#define OSCILLATOR_TABLE_BITS 11
+/** @brief Number of samples in one period of a wavetable. */
+#define OSCILLATOR_TABLE_SIZE (1 << OSCILLATOR_TABLE_BITS)
+
+/**
+ * @enum Waveform
+ * @brief Shapes available as precomputed wavetables.
+ */
+enum Waveform {
+    WAVEFORM_SINE,
+    WAVEFORM_SQUARE,
+    WAVEFORM_TRIANGLE,
+    WAVEFORM_COUNT
+};
+
+/**
+ * @brief Compute the wavetables. Called by Oscillator_init, must first run before any audio thread starts.
+ */
+void Oscillator_initTables();
+
+/**
+ * @brief Start an oscillator at phase zero.
+ *
+ * @param oscillator Oscillator to initialize.
+ * @param waveform Shape to play.
+ * @param frequency Frequency in Hz, below half the sample rate.
+ * @param sample_rate Output sample rate in Hz.
+ */
+void Oscillator_init(Oscillator* oscillator, Waveform waveform, float frequency, int sample_rate);
+
+/**
+ * @brief Change the frequency without resetting the phase, for sweeps.
+ *
+ * @param oscillator Oscillator to update.
+ * @param frequency Frequency in Hz.
+ * @param sample_rate Output sample rate in Hz.
+ */
+INLINE void Oscillator_setFrequency(Oscillator* oscillator, float frequency, int sample_rate) {
+    oscillator->step = (Uint32) (frequency / (float) sample_rate * 4294967296.f);
+}
+
+/**
+ * @brief Produce the next sample and advance the phase.
+ *
+ * @param oscillator Oscillator to read.
+ * @return Sample in [-1, 1].
+ */
+INLINE float Oscillator_next(Oscillator* oscillator) {
+    float sample = oscillator->table[oscillator->phase >> (32 - OSCILLATOR_TABLE_BITS)];
+    oscillator->phase += oscillator->step;
+    return sample;
+}
+
+/**
+ * @brief Get a printable name for a waveform.
+ *
+ * @param waveform Waveform to name.
+ * @return Static string, "Unknown" for invalid values.
+ */
+const char* Waveform_toString(Waveform waveform);
@@ -0,0 +1,313 @@
+/*
+ * Copyright (c) 2025 Torisutan
+ * All rights reserved
+ */
+
+#pragma once
+
+#include "Settings.h"
+
+/** @brief Most threads a parallel sort uses, whatever the core count. */
+#define PARALLEL_SORT_MAX_THREADS 64
+/** @brief Fewest elements given to each thread, smaller lists use fewer threads. */
+#define PARALLEL_SORT_MIN_PER_THREAD 4096
+/** @brief Ranges under this many elements are finished with an insertion sort. */
+#define PARALLEL_SORT_INSERTION_THRESHOLD 16
+
+/** @brief Samples taken per bucket to choose the sample sort splitters. */
+#define SORT_SAMPLE_OVERSAMPLING 8
+/** @brief Sample sort buckets per thread, so that threads done early take the remaining ones. */
+#define SORT_SAMPLE_BUCKETS_PER_THREAD 4
+/** @brief Most sample sort buckets, bucket indexes are stored on one byte. */
+#define SORT_SAMPLE_MAX_BUCKETS 256
+
+/** @brief Parallel quicksort ranges this small are sorted by the thread holding them. */
+#define PARALLEL_QUICK_GRAIN 256
+/** @brief Ranges a parallel quicksort thread can hold, it sorts the next ones itself. */
+#define PARALLEL_QUICK_DEQUE_SIZE 64
+
+/** @brief Bits of the key sorted by each parallel radix pass. */
+#define PARALLEL_RADIX_BITS 8
+/** @brief Buckets of a parallel radix pass. */
+#define PARALLEL_RADIX_BUCKETS (1 << PARALLEL_RADIX_BITS)
+/** @brief Size of a cache line, which the radix write-combining lines and flushes are aligned on. */
+#define PARALLEL_SORT_CACHE_LINE 64
+/** @brief Elements gathered per bucket before being written out, one cache line of pointers. */
+#define PARALLEL_RADIX_COMBINE (PARALLEL_SORT_CACHE_LINE / (int) sizeof(void*))
+
+/**
+ * @struct ParallelSortContext
+ * @brief Arguments of a sort shared by all its threads.
+ *
+ * - compare_func / gm / delay_func / mainframe / column_graph: as given to Vector_sort.
+ *   The threads call delay_func concurrently, without any lock of their own.
+ */
+struct ParallelSortContext {
+    CompareFunc compare_func;
+    SDL_mutex* gm;
+    DelayFunc delay_func;
+    MainFrame* mainframe;
+    ColumnGraph* column_graph;
+};
+
+/**
+ * @struct ParallelSortWorker
+ * @brief One thread of a parallel sort.
+ *
+ * - job: state of the sort, shared by all its workers.
+ * - pool: pool the worker belongs to.
+ * - stats: counters of this thread alone, added to the graph stats after each phase.
+ * - index / thread_count: rank of the worker and number of workers.
+ */
+struct ParallelSortWorker {
+    void* job;
+    ParallelSortPool* pool;
+    GraphStats* stats;
+    int index;
+    int thread_count;
+};
+
+/**
+ * @struct ParallelSortPool
+ * @brief Threads of a parallel sort, started once and reused by every phase.
+ *
+ * - name: sort name, the threads show as "<name> worker <index>" in traces.
+ * - workers / count: the workers, worker 0 running on the sorting thread.
+ * - threads: thread of each other worker, NULL if it could not be started.
+ * - wake: one semaphore per thread, posted to start a phase.
+ * - done: posted by each thread once it finished the phase.
+ * - phase: function of the current phase, NULL to make the threads exit.
+ */
+struct ParallelSortPool {
+    const char* name;
+    ParallelSortWorker* workers;
+    int count;
+    SDL_Thread* threads[PARALLEL_SORT_MAX_THREADS];
+    SDL_sem* wake[PARALLEL_SORT_MAX_THREADS];
+    SDL_sem* done;
+    SDL_ThreadFunction phase;
+};
+
+/**
+ * @struct SampleSort
+ * @brief State of a parallel sample sort.
+ *
+ * - context: sort arguments.
+ * - data / size: the list being sorted.
+ * - output: buffer the elements are scattered into, grouped by bucket.
+ * - oracle: bucket of each element, computed once by the classification.
+ * - tree: splitters as an implicit binary search tree, node i having children 2i and 2i + 1.
+ * - bucket_count / levels: number of buckets (a power of two) and its base 2 logarithm.
+ * - offsets: per thread and bucket element counts, then scatter positions.
+ * - bucket_starts: first index of each bucket, bucket_count + 1 entries.
+ * - next_bucket: next bucket to sort, taken by the threads in turn.
+ */
+struct SampleSort {
+    ParallelSortContext context;
+    void** data;
+    size_t size;
+    void** output;
+    Uint8* oracle;
+    void* tree[SORT_SAMPLE_MAX_BUCKETS];
+    int bucket_count;
+    int levels;
+    size_t* offsets;
+    size_t bucket_starts[SORT_SAMPLE_MAX_BUCKETS + 1];
+    SDL_atomic_t next_bucket;
+};
+
+/**
+ * @struct WorkDeque
+ * @brief Ranges waiting to be sorted, owned by one thread of a parallel quicksort.
+ *
+ * The owner pushes and pops at the bottom, newest first, while idle threads
+ * steal from the top, where the oldest and largest ranges are.
+ *
+ * - starts / ends: ranges, in a ring indexed modulo PARALLEL_QUICK_DEQUE_SIZE.
+ * - top / bottom: index of the oldest range and after the newest one.
+ * - lock: taken by the owner and the thieves around each operation.
+ */
+struct WorkDeque {
+    size_t starts[PARALLEL_QUICK_DEQUE_SIZE];
+    size_t ends[PARALLEL_QUICK_DEQUE_SIZE];
+    int top;
+    int bottom;
+    SDL_SpinLock lock;
+};
+
+/**
+ * @struct ParallelQuickSort
+ * @brief State of a parallel quicksort.
+ *
+ * - context: sort arguments.
+ * - data / size: the list being sorted.
+ * - buffer / oracle: scatter buffer and class of each element for the parallel partitions.
+ * - counts: per thread count of elements smaller, equal and greater than the pivot,
+ *   then where the thread scatters them.
+ * - pivot / start / end: pivot and range of the current parallel partition.
+ * - deques: one per thread.
+ * - pending: ranges pushed and not sorted yet, the threads stop when it reaches 0.
+ */
+struct ParallelQuickSort {
+    ParallelSortContext context;
+    void** data;
+    size_t size;
+    void** buffer;
+    Uint8* oracle;
+    size_t counts[PARALLEL_SORT_MAX_THREADS * 3];
+    void* pivot;
+    size_t start;
+    size_t end;
+    WorkDeque* deques;
+    SDL_atomic_t pending;
+};
+
+/**
+ * @struct ParallelRadixSort
+ * @brief State of a parallel LSD radix sort.
+ *
+ * - context: sort arguments.
+ * - data / size: the list being sorted.
+ * - source / target: arrays read and written by the current pass, the list and a buffer.
+ * - visible: whether each pass is copied back to the list to be shown.
+ * - min / shift: smallest value, keys being value - min, and first key bit of the pass.
+ * - counts: per thread and bucket element counts, then scatter positions.
+ * - combine / fill: per thread and bucket write-combining lines, aligned on
+ *   PARALLEL_SORT_CACHE_LINE, and how full they are.
+ * - combine_memory: allocation holding combine.
+ * - mins / maxs: smallest and largest value of each thread slice.
+ */
+struct ParallelRadixSort {
+    ParallelSortContext context;
+    void** data;
+    size_t size;
+    void** source;
+    void** target;
+    bool visible;
+    long min;
+    int shift;
+    size_t* counts;
+    void** combine;
+    void* combine_memory;
+    Uint8* fill;
+    long mins[PARALLEL_SORT_MAX_THREADS];
+    long maxs[PARALLEL_SORT_MAX_THREADS];
+};
+
+/**
+ * @brief Number of threads to sort a list of \p size elements with.
+ *
+ * One per core (SDL_GetCPUCount), at most PARALLEL_SORT_MAX_THREADS and
+ * keeping at least PARALLEL_SORT_MIN_PER_THREAD elements per thread.
+ *
+ * @param size Number of elements.
+ * @return Thread count, at least 1.
+ */
+int ParallelSort_threadCount(size_t size);
+
+/**
+ * @brief Fill a context with the arguments of a sort.
+ */
+void ParallelSort_initContext(ParallelSortContext* context, CompareFunc compare_func, SDL_mutex* gm, DelayFunc delay_func, MainFrame* mainframe, ColumnGraph* column_graph);
+
+/**
+ * @brief Start a pool of \p count workers sharing \p job, each with its own stats.
+ *
+ * The count - 1 threads are created here and wait for ParallelSort_run. A
+ * thread that cannot be created leaves its worker to the calling thread.
+ * While a trace is recorded, the threads are named after \p name (a literal).
+ *
+ * @return The pool, to free with ParallelSort_destroyPool, or NULL on failure.
+ */
+ParallelSortPool* ParallelSort_createPool(void* job, int count, const char* name);
+
+/**
+ * @brief Stop the threads of a pool made by ParallelSort_createPool and free it.
+ */
+void ParallelSort_destroyPool(ParallelSortPool* pool);
+
+/**
+ * @brief Run one phase of a parallel sort on every worker and wait for them.
+ *
+ * Worker 0 runs on the calling thread while the pool threads run the others.
+ * The worker stats are then added to \p stats and reset.
+ *
+ * @param pool Pool made by ParallelSort_createPool.
+ * @param phase Function run with each worker as argument.
+ * @param stats Stats receiving the counters of the phase, may be NULL.
+ */
+void ParallelSort_run(ParallelSortPool* pool, SDL_ThreadFunction phase, GraphStats* stats);
+
+/**
+ * @brief Show a sort step from any thread of the sort.
+ *
+ * The threads do not wait for each other: delay_func locks the graph only
+ * while it highlights the bars, and sleeps outside of it.
+ */
+void ParallelSort_delay(ParallelSortContext* context, void* a, void* b);
+
+/**
+ * @brief Swap two elements under the graph mutex and show the step.
+ */
+void ParallelSort_swap(ParallelSortContext* context, GraphStats* stats, void** data, size_t i, size_t j);
+
+/**
+ * @brief Three-way partition of data[start, end) around \p pivot.
+ *
+ * @param lt Set to the first element equal to the pivot.
+ * @param gt Set to the first element greater than the pivot.
+ */
+void ParallelSort_partition(ParallelSortContext* context, GraphStats* stats, void** data, size_t start, size_t end, void* pivot, size_t* lt, size_t* gt);
+
+/**
+ * @brief Serial sort of data[start, end), run by each thread on its own range.
+ *
+ * Quicksort with a median of three pivot and a three-way partition, so
+ * repeated values cost nothing, recursing only on the smaller side.
+ * Ranges under PARALLEL_SORT_INSERTION_THRESHOLD use an insertion sort.
+ *
+ * @param context Sort arguments; with no mutex nor delay it sorts a private buffer.
+ * @param stats Stats of the calling thread.
+ * @param data Array holding the range.
+ * @param start First index of the range.
+ * @param end Index after the range.
+ */
+void ParallelSort_sortRange(ParallelSortContext* context, GraphStats* stats, void** data, size_t start, size_t end);
+
+/**
+ * @brief Parallel sample sort.
+ *
+ * Splitters are picked from SORT_SAMPLE_OVERSAMPLING random samples per
+ * bucket and laid out as a binary search tree, which every thread walks
+ * without branching to classify its slice. A prefix sum of the per-thread
+ * bucket counts gives each thread where to scatter its elements, then the
+ * buckets are copied back and sorted concurrently, on SDL_GetCPUCount threads.
+ */
+void Vector_sortSample(Vector* list, CompareFunc compare_func, SDL_mutex* gm, DelayFunc delay_func, MainFrame* mainframe, ColumnGraph* column_graph);
+
+/**
+ * @brief Parallel quicksort with work stealing.
+ *
+ * The largest ranges are first partitioned by all threads together, until
+ * there is one per thread. Each thread then partitions its ranges, pushing
+ * one side on its deque and going on with the other, and sorts the ranges
+ * under PARALLEL_QUICK_GRAIN itself. A thread with nothing left steals the
+ * oldest range of another one.
+ */
+void Vector_sortParallelQuick(Vector* list, CompareFunc compare_func, SDL_mutex* gm, DelayFunc delay_func, MainFrame* mainframe, ColumnGraph* column_graph);
+
+/**
+ * @brief Parallel LSD radix sort for integer graphs.
+ *
+ * Sorts PARALLEL_RADIX_BITS bits of value - min per pass, only as many passes
+ * as the value range needs. Each thread counts the digits of its slice, a
+ * prefix sum gives every thread where to write each bucket, and the threads
+ * scatter through per-bucket write-combining lines of PARALLEL_RADIX_COMBINE
+ * elements. A line is flushed when it reaches a cache line boundary of the
+ * target, the first flush of a bucket being shorter, so that writes go out a
+ * whole cache line at a time. Passes go back and
+ * forth between the list and a buffer, the passes writing the list holding the
+ * graph mutex, or are copied back to the list after each pass when the sort is shown.
+ * Only supports lists whose associated ColumnGraph has type GRAPH_TYPE_INT.
+ */
+void Vector_sortParallelRadix(Vector* list, CompareFunc compare_func, SDL_mutex* gm, DelayFunc delay_func, MainFrame* mainframe, ColumnGraph* column_graph);
@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2025 Torisutan
+ * ALl rights reserved
+ */
+
+#pragma once
+
+#include "Settings.h"
+
+/**
+ * @struct Pool
+ * @brief Allocator for many small objects of one fixed size.
+ *
+ * Objects are carved out of chunks of \p chunk_capacity slots and recycled
+ * through an intrusive free list, so allocating and releasing is a pointer
+ * swap instead of a malloc/free pair. Chunks are only given back to the
+ * system by Pool_release. All operations are guarded by a spin lock so sort
+ * threads may allocate as well.
+ *
+ * - object_size: size of one slot, at least a pointer wide.
+ * - chunk_capacity: number of slots allocated at once when the pool is empty.
+ * - free_list: first free slot, each free slot stores the next one.
+ * - chunks: allocated chunks, each chunk stores the previous one in its first slot.
+ * - in_use: number of slots currently handed out.
+ * - lock: spin lock protecting the pool.
+ */
+struct Pool {
+    size_t object_size;
+    size_t chunk_capacity;
+    void* free_list;
+    void* chunks;
+    size_t in_use;
+    SDL_SpinLock lock;
+};
+
+/**
+ * @def POOL_INITIALIZER
+ * @brief Static initializer for a Pool of \p type objects, \p count per chunk.
+ *
+ * No memory is allocated until the first Pool_alloc.
+ */
+#define POOL_INITIALIZER(type, count) { \
+    sizeof(type) > sizeof(void*) ? sizeof(type) : sizeof(void*), (count), NULL, NULL, 0, 0 }
+
+/**
+ * @brief Create a heap-allocated pool.
+ *
+ * @param object_size Size of one object in bytes.
+ * @param chunk_capacity Number of objects allocated at once when the pool runs dry.
+ * @return Pointer to the new Pool, or NULL on allocation failure.
+ */
+Pool* Pool_create(size_t object_size, size_t chunk_capacity);
+
+/**
+ * @brief Release every chunk of a pool created by Pool_create and free the pool.
+ *
+ * @param pool Pool to destroy. Safe to pass NULL.
+ */
+void Pool_destroy(Pool* pool);
+
+/**
+ * @brief Take a zeroed slot from the pool, growing it by one chunk if needed.
+ *
+ * @param pool Pool to allocate from.
+ * @return Pointer to a zeroed slot of pool->object_size bytes, or NULL on allocation failure.
+ */
+void* Pool_alloc(Pool* pool);
+
+/**
+ * @brief Give a slot back to the pool.
+ *
+ * The slot must come from Pool_alloc on the same pool. Safe to pass NULL.
+ *
+ * @param pool Pool the slot belongs to.
+ * @param ptr Slot to release.
+ */
+void Pool_free(Pool* pool, void* ptr);
+
+/**
+ * @brief Mark every slot of the pool free again, keeping the chunks.
+ *
+ * All slots handed out by the pool become invalid. Cheaper than releasing
+ * them one by one, and the next allocations reuse the memory without malloc.
+ *
+ * @param pool Pool to clear.
+ */
+void Pool_clear(Pool* pool);
+
+/**
+ * @brief Free every chunk of the pool at once.
+ *
+ * All slots handed out by the pool become invalid. The pool can be used again afterwards.
+ *
+ * @param pool Pool to release.
+ */
+void Pool_release(Pool* pool);
@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) 2025 Torisutan
+ * ALl rights reserved
+ */
+
+#pragma once
+
+#include "Settings.h"
+
+/** @brief Number of frames kept per phase for the histograms and percentiles. */
+#define PROFILER_HISTORY 240
+/** @brief Number of histogram buckets drawn per phase. */
+#define PROFILER_BUCKETS 32
+/** @brief Interval between two refreshes of the overlay statistics, in milliseconds. */
+#define PROFILER_REFRESH_MS 250
+/** @brief A frame is counted as dropped when it lasts longer than this many frame budgets. */
+#define PROFILER_DROP_FACTOR 1.5f
+
+/**
+ * @enum ProfilerPhase
+ * @brief Timed sections of a main loop iteration.
+ *
+ * PROFILER_PHASE_FRAME is not timed with a scope: it is the interval between
+ * two Profiler_endFrame calls, so it includes vsync waits and frame pacing.
+ */
+enum ProfilerPhase {
+    PROFILER_PHASE_INPUT,
+    PROFILER_PHASE_UPDATE,
+    PROFILER_PHASE_RENDER,
+    PROFILER_PHASE_PRESENT,
+    PROFILER_PHASE_FRAME,
+    PROFILER_PHASE_COUNT
+};
+
+/**
+ * @struct Profiler
+ * @brief Frame-time profiler with an on-screen overlay.
+ *
+ * The main thread times each phase with PROFILER_SCOPE and closes the frame
+ * with Profiler_endFrame. Sort threads report their steps with
+ * Profiler_countOp, which is lock free. Percentiles, histograms and rates are
+ * recomputed every PROFILER_REFRESH_MS, not every frame.
+ *
+ * - samples: ring buffer of the last PROFILER_HISTORY durations (ms) per phase.
+ * - current: time accumulated by each phase during the frame in progress (ms).
+ * - head / count: next slot and number of valid entries in samples.
+ * - p50 / p99 / max: statistics of samples at the last refresh (ms).
+ * - buckets: histogram of samples at the last refresh, from 0 to max.
+ * - frame_start: performance counter at the previous Profiler_endFrame.
+ * - dropped_total / dropped_window: dropped frames since creation / in the history.
+ * - ops / ops_seen / ops_per_sec: per graph step counters and their rate.
+ * - last_refresh: tick of the last statistics refresh.
+ * - visible: whether the overlay is drawn.
+ * - lines: overlay texts, created on first render.
+ */
+struct Profiler {
+    float samples[PROFILER_PHASE_COUNT][PROFILER_HISTORY];
+    float current[PROFILER_PHASE_COUNT];
+    int head;
+    int count;
+    float p50[PROFILER_PHASE_COUNT];
+    float p99[PROFILER_PHASE_COUNT];
+    float max[PROFILER_PHASE_COUNT];
+    int buckets[PROFILER_PHASE_COUNT][PROFILER_BUCKETS];
+    Uint64 frame_start;
+    Uint64 dropped_total;
+    int dropped_window;
+    SDL_atomic_t ops[MAX_GRAPHS];
+    int ops_seen[MAX_GRAPHS];
+    float ops_per_sec[MAX_GRAPHS];
+    Uint64 last_refresh;
+    bool visible;
+    Text* lines[PROFILER_PHASE_COUNT + 2];
+};
+
+/**
+ * @brief Time the statement or block that follows as \p phase.
+ *
+ * Usage: PROFILER_SCOPE(profiler, PROFILER_PHASE_UPDATE) { Frame_update(frame); }
+ * Leaving the block with break, continue, return or goto skips the measure.
+ *
+ * @param profiler Profiler receiving the measure.
+ * @param phase ProfilerPhase to accumulate into.
+ */
+#define PROFILER_SCOPE(profiler, phase) \
+    for (Uint64 profiler_start_ = Profiler_begin(), profiler_once_ = 1; profiler_once_; \
+         profiler_once_ = 0, Profiler_end(profiler, phase, profiler_start_))
+
+/**
+ * @brief Create a profiler with an empty history and a hidden overlay.
+ *
+ * @return Pointer to the new Profiler, or NULL on allocation failure.
+ */
+Profiler* Profiler_create();
+
+/**
+ * @brief Destroy a profiler and its overlay texts.
+ *
+ * Must be called while the renderer still exists.
+ *
+ * @param profiler Profiler to destroy. Safe to pass NULL.
+ */
+void Profiler_destroy(Profiler* profiler);
+
+/**
+ * @brief Start measuring a section.
+ *
+ * @return Current performance counter, to pass to Profiler_end.
+ */
+Uint64 Profiler_begin();
+
+/**
+ * @brief Stop measuring a section and add its duration to \p phase.
+ *
+ * A phase may be measured several times per frame, durations add up.
+ *
+ * @param profiler Profiler receiving the measure.
+ * @param phase Phase the section belongs to.
+ * @param start Value returned by Profiler_begin.
+ */
+void Profiler_end(Profiler* profiler, ProfilerPhase phase, Uint64 start);
+
+/**
+ * @brief Close the current frame: store its phase durations and count drops.
+ *
+ * Call once per main loop iteration, after presenting.
+ *
+ * @param profiler Profiler to update.
+ */
+void Profiler_endFrame(Profiler* profiler);
+
+/**
+ * @brief Count one visualized step of the sort running on graph \p graph_index.
+ *
+ * Safe to call from sort threads.
+ *
+ * @param profiler Profiler to update. Safe to pass NULL.
+ * @param graph_index Index of the graph, ignored when out of range.
+ */
+void Profiler_countOp(Profiler* profiler, int graph_index);
+
+/**
+ * @brief Show or hide the overlay.
+ *
+ * @param profiler Profiler to toggle.
+ */
+void Profiler_toggle(Profiler* profiler);
+
+/**
+ * @brief Draw the overlay in the top-left corner if it is visible.
+ *
+ * Draws one line of p50/p99 and one histogram per phase, then dropped frames
+ * and the sort steps per second of each active graph.
+ *
+ * @param profiler Profiler to draw.
+ * @param app App providing the renderer and the fonts.
+ */
+void Profiler_render(Profiler* profiler, App* app);
+
+/**
+ * @brief Get a printable name for a phase.
+ *
+ * @param phase Phase to name.
+ * @return Static string, "Unknown" for invalid values.
+ */
+const char* ProfilerPhase_toString(ProfilerPhase phase);
@@ -45,6 +45,12 @@
  */
 #define DEFAULT_BOLD_FONT "Inter-Bold.ttf"
 
+/**
+ * @def RESOURCE_TONE_MAX
+ * @brief Largest frequency (Hz) and duration (ms) of a cached tone, both are packed in its key.
+ */
+#define RESOURCE_TONE_MAX 16383
+
 /**
  * @struct ResourceManager
  * @brief Holds renderer and asset caches used by the application.
@@ -58,6 +64,7 @@ struct ResourceManager {
     Map* texturesCache;     /**< Map<string, SDL_Texture*> for loaded textures. */
     Map* fontsCache;        /**< Map<string, Map<int, TTF_Font*>> grouping fonts by filename and size. */
     Map* soundsCache;       /**< Map<string, Mix_Chunk*> for loaded sound effects. */
+    Map* tonesCache;        /**< Map<int, Mix_Chunk*> for generated tones, keyed by waveform, frequency and duration. */
 };
 
 /**
@@ -118,6 +125,22 @@ TTF_Font* ResourceManager_getFont(ResourceManager* self, const char* filename, i
  */
 Mix_Chunk* ResourceManager_getSound(ResourceManager* self, const char* filename);
 
+/**
+ * @brief Render or retrieve a cached tone.
+ *
+ * Each tone is rendered once with Audio_createTone and kept until the manager
+ * is destroyed, so a beep played again, like the sound toggle one, costs no
+ * synthesis. Sort step tones do not go through this cache: they are voices
+ * synthesized by Audio_pushTone in the mixer output.
+ *
+ * @param self Resource manager instance.
+ * @param waveform Shape of the tone.
+ * @param frequency Frequency in Hz, from 1 to RESOURCE_TONE_MAX.
+ * @param duration_ms Duration in milliseconds, from 1 to RESOURCE_TONE_MAX.
+ * @return Mix_Chunk\* owned by the manager, or NULL on failure.
+ */
+Mix_Chunk* ResourceManager_getTone(ResourceManager* self, Waveform waveform, int frequency, int duration_ms);
+
 /**
  * @brief Convenience accessor for the application's default font.
  *
@@ -7,6 +7,37 @@
 
 #include "Settings.h"
 
+/**
+ * @brief Heap sort switches from a binary to a 4-ary heap from this many elements.
+ *
+ * A 4-ary heap is half as deep and keeps the children of a node in one cache
+ * line, which pays off on large lists. This is only the default of
+ * Vector_sortHeap: Vector_sortHeapQuaternary always uses a 4-ary heap.
+ */
+#define SORT_HEAP_QUATERNARY_THRESHOLD 4096
+
+/**
+ * @brief Counting sort is used while the value range is below this many times the element count.
+ *
+ * Wider ranges are sorted SORT_COUNTING_RADIX_BITS at a time instead, as an LSD radix sort.
+ */
+#define SORT_COUNTING_RANGE_FACTOR 4
+
+/** @brief Bits of value - min counted per pass once the range is too wide for one histogram. */
+#define SORT_COUNTING_RADIX_BITS 8
+
+/** @brief MSD radix sort finishes buckets smaller than this with an insertion sort. */
+#define SORT_MSD_INSERTION_THRESHOLD 32
+
+/** @brief Multikey quicksort finishes partitions smaller than this with an insertion sort. */
+#define SORT_MULTIKEY_INSERTION_THRESHOLD 16
+
+/** @brief Block merge sort insertion sorts lists shorter than this. */
+#define SORT_BLOCK_MERGE_INSERTION_THRESHOLD 16
+
+/** @brief Maximum number of gaps a Shell sort pass list holds (Pratt's sequence is the longest). */
+#define SORT_SHELL_MAX_GAPS 512
+
 // TODO use sort args struct to reduce parameters
 /**
  * @struct SortArgs
@@ -37,47 +68,44 @@ struct SortArgs {
  * @param b Second value to compare.
  * @return <0 if a < b, 0 if a == b, >0 if a > b.
  */
-int List_defaultCompare(const void* a, const void* b);
+int Vector_defaultCompare(const void* a, const void* b);
 
 /**
  * @brief Dispatch function selecting and running the requested sort algorithm.
  *
  * The implementation will call the specific algorithm identified by \p sortType.
  *
- * @param list Pointer to the List to sort (must not be NULL).
+ * @param list Pointer to the Vector to sort (must not be NULL).
  * @param sortType Enum value selecting the sort algorithm.
- * @param compare_func Comparison callback or NULL to use List_defaultCompare.
+ * @param compare_func Comparison callback or NULL to use Vector_defaultCompare.
  * @param gm Pointer to an SDL_mutex used to protect list modifications (may be NULL if not required).
  * @param delay_func Callback used to produce delays/visual updates during sorting (may be NULL).
  * @param mainframe Pointer to the MainFrame used by delay callbacks (may be NULL).
  * @param column_graph Pointer to the ColumnGraph associated with the list (may be NULL).
  */
-void List_sort(List* list, ListSortType sortType, CompareFunc compare_func, SDL_mutex* gm, DelayFunc delay_func, MainFrame* mainframe, ColumnGraph* column_graph);
+void Vector_sort(Vector* list, ListSortType sortType, CompareFunc compare_func, SDL_mutex* gm, DelayFunc delay_func, MainFrame* mainframe, ColumnGraph* column_graph);
 
 /**
  * @brief Test whether a list is sorted according to the provided comparator.
  *
- * @param list Pointer to the List to test.
- * @param compare_func Comparison function to use or NULL to use List_defaultCompare.
+ * @param list Pointer to the Vector to test.
+ * @param compare_func Comparison function to use or NULL to use Vector_defaultCompare.
  * @return true if the list is sorted or contains fewer than two elements.
  */
-bool List_isSorted(List* list, CompareFunc compare_func);
+bool Vector_isSorted(Vector* list, CompareFunc compare_func);
 
 /**
- * @brief Bubble sort implementation operating on a List.
+ * @brief Bubble sort implementation operating on a Vector.
  *
  * Thread-safe modifications must be guarded by the provided \p gm mutex. Visual
  * updates are emitted via \p delay_func when provided.
  */
-void List_sortBubble(List* list, CompareFunc compare_func, SDL_mutex* gm, DelayFunc delay_func, MainFrame* mainframe, ColumnGraph* column_graph);
+void Vector_sortBubble(Vector* list, CompareFunc compare_func, SDL_mutex* gm, DelayFunc delay_func, MainFrame* mainframe, ColumnGraph* column_graph);
 
 /**
- * @brief Quick sort implementation for doubly-linked lists.
- *
- * The routine temporarily breaks circular links to perform recursive partitioning
- * and restores list invariants before returning.
+ * @brief Quick sort implementation (Lomuto partition on index ranges).
  */
-void List_sortQuick(List* list, CompareFunc compare_func, SDL_mutex* gm, DelayFunc delay_func, MainFrame* mainframe, ColumnGraph* column_graph);
+void Vector_sortQuick(Vector* list, CompareFunc compare_func, SDL_mutex* gm, DelayFunc delay_func, MainFrame* mainframe, ColumnGraph* column_graph);
 
 /**
  * @brief Merge sort implementation using an auxiliary array.
@@ -85,12 +113,12 @@ void List_sortQuick(List* list, CompareFunc compare_func, SDL_mutex* gm, DelayFu
  * Allocates a temporary buffer of size list->size; on allocation failure the
  * function logs an error and returns without modifying the list.
  */
-void List_sortMerge(List* list, CompareFunc compare_func, SDL_mutex* gm, DelayFunc delay_func, MainFrame* mainframe, ColumnGraph* column_graph);
+void Vector_sortMerge(Vector* list, CompareFunc compare_func, SDL_mutex* gm, DelayFunc delay_func, MainFrame* mainframe, ColumnGraph* column_graph);
 
 /**
  * @brief Insertion sort implementation.
  */
-void List_sortInsertion(List* list, CompareFunc compare_func, SDL_mutex* gm, DelayFunc delay_func, MainFrame* mainframe, ColumnGraph* column_graph);
+void Vector_sortInsertion(Vector* list, CompareFunc compare_func, SDL_mutex* gm, DelayFunc delay_func, MainFrame* mainframe, ColumnGraph* column_graph);
 
 /**
  * @brief Bitonic sort implementation.
@@ -98,17 +126,17 @@ void List_sortInsertion(List* list, CompareFunc compare_func, SDL_mutex* gm, Del
  * Requires the list size to be a power of two; otherwise the function logs an error
  * and returns without sorting.
  */
-void List_sortBitonic(List* list, CompareFunc compare_func, SDL_mutex* gm, DelayFunc delay_func, MainFrame* mainframe, ColumnGraph* column_graph);
+void Vector_sortBitonic(Vector* list, CompareFunc compare_func, SDL_mutex* gm, DelayFunc delay_func, MainFrame* mainframe, ColumnGraph* column_graph);
 
 /**
  * @brief Bogo sort (random shuffles until sorted). Intended for demonstration only.
  */
-void List_sortBogo(List* list, CompareFunc compare_func, SDL_mutex* gm, DelayFunc delay_func, MainFrame* mainframe, ColumnGraph* column_graph);
+void Vector_sortBogo(Vector* list, CompareFunc compare_func, SDL_mutex* gm, DelayFunc delay_func, MainFrame* mainframe, ColumnGraph* column_graph);
 
 /**
  * @brief Selection sort implementation.
  */
-void List_sortSelection(List* list, CompareFunc compare_func, SDL_mutex* gm, DelayFunc delay_func, MainFrame* mainframe, ColumnGraph* column_graph);
+void Vector_sortSelection(Vector* list, CompareFunc compare_func, SDL_mutex* gm, DelayFunc delay_func, MainFrame* mainframe, ColumnGraph* column_graph);
 
 /**
  * @brief Radix sort implementation for integer graphs.
@@ -116,7 +144,98 @@ void List_sortSelection(List* list, CompareFunc compare_func, SDL_mutex* gm, Del
  * Only supports lists whose associated ColumnGraph has type GRAPH_TYPE_INT.
  * Values are treated as non-negative integers stored as pointer-sized integers.
  */
-void List_sortRadix(List* list, CompareFunc compare_func, SDL_mutex* gm, DelayFunc delay_func, MainFrame* mainframe, ColumnGraph* column_graph);
+void Vector_sortRadix(Vector* list, CompareFunc compare_func, SDL_mutex* gm, DelayFunc delay_func, MainFrame* mainframe, ColumnGraph* column_graph);
+
+/**
+ * @brief Heap sort using Floyd's bottom-up sift-down.
+ *
+ * In place with a guaranteed O(n log n). Each sift-down follows the largest
+ * children down to a leaf, then climbs back to where the root belongs, which
+ * saves about half the comparisons of the classic version. The arity defaults
+ * to a binary heap below SORT_HEAP_QUATERNARY_THRESHOLD elements and a 4-ary
+ * heap from there.
+ */
+void Vector_sortHeap(Vector* list, CompareFunc compare_func, SDL_mutex* gm, DelayFunc delay_func, MainFrame* mainframe, ColumnGraph* column_graph);
+
+/**
+ * @brief Heap sort on a 4-ary heap whatever the list size.
+ *
+ * Same algorithm as Vector_sortHeap, to compare both arities on small lists.
+ */
+void Vector_sortHeapQuaternary(Vector* list, CompareFunc compare_func, SDL_mutex* gm, DelayFunc delay_func, MainFrame* mainframe, ColumnGraph* column_graph);
+
+/**
+ * @brief Shell sort: insertion sort over decreasing gaps, the last one being 1.
+ *
+ * The gap sequence is the one of \p column_graph (ColumnGraph::shell_gaps),
+ * Ciura's when there is no graph. Each gap is recorded as a pass in the graph
+ * stats (see GraphStats_beginPass) and the passes are logged once sorted.
+ */
+void Vector_sortShell(Vector* list, CompareFunc compare_func, SDL_mutex* gm, DelayFunc delay_func, MainFrame* mainframe, ColumnGraph* column_graph);
+
+/**
+ * @brief Stable counting sort for integer graphs, O(n + k).
+ *
+ * Finds the value range first, then counts each value and scatters the bars
+ * in one pass. When the range exceeds SORT_COUNTING_RANGE_FACTOR times the
+ * element count, the same stable count and scatter is run once per
+ * SORT_COUNTING_RADIX_BITS digit of value - min, an LSD radix sort whose
+ * cost stays O(n) per pass whatever the distribution of the values.
+ * Only supports lists whose associated ColumnGraph has type GRAPH_TYPE_INT.
+ */
+void Vector_sortCounting(Vector* list, CompareFunc compare_func, SDL_mutex* gm, DelayFunc delay_func, MainFrame* mainframe, ColumnGraph* column_graph);
+
+/**
+ * @brief In-place MSD radix sort (American flag sort) for string graphs.
+ *
+ * Keeps the ordering of ColumnGraphBar_compare, shorter strings first and then
+ * lexicographic: the bars are first bucketed by length, then each bucket by
+ * one character at a time, swapping every bar straight into its bucket.
+ * Buckets under SORT_MSD_INSERTION_THRESHOLD bars are finished with an
+ * insertion sort. Every character read counts as a memory read.
+ * Integer graphs are handed to Vector_sortRadix.
+ */
+void Vector_sortMsdRadix(Vector* list, CompareFunc compare_func, SDL_mutex* gm, DelayFunc delay_func, MainFrame* mainframe, ColumnGraph* column_graph);
+
+/**
+ * @brief Multikey quicksort (Bentley-Sedgewick) for string graphs.
+ *
+ * Three-way partitions on the length, then on one character at a time: the
+ * bars equal to the pivot move on to the next character, so a shared prefix
+ * is read once instead of on every comparison. Each key-versus-pivot character test goes to
+ * GraphStats::char_comparisons, the whole-string comparisons of the insertion
+ * sort finishing small partitions to GraphStats::comparisons.
+ * Integer graphs are handed to Vector_sortQuick.
+ */
+void Vector_sortMultikeyQuick(Vector* list, CompareFunc compare_func, SDL_mutex* gm, DelayFunc delay_func, MainFrame* mainframe, ColumnGraph* column_graph);
+
+/**
+ * @brief Stable in-place block merge sort (GrailSort).
+ *
+ * The first 2 sqrt(n) distinct values are moved to the front: sqrt(n) of them
+ * serve as an internal merge buffer, swapped with the elements being merged,
+ * the others tag the blocks of sqrt(n) elements. Runs are built with the
+ * buffer, then each pair of runs is cut into blocks, the blocks are selection
+ * sorted by their first element (the tags keeping equal blocks in order) and
+ * merged locally through the buffer. The keys are finally sorted and merged
+ * back with rotations. O(n log n) comparisons and moves, and O(1) extra
+ * memory: the sort state is all that is counted as auxiliary.
+ * Lists with fewer distinct values use the keys found as a smaller buffer, or
+ * rotation merges below 4 of them.
+ */
+void Vector_sortBlockMerge(Vector* list, CompareFunc compare_func, SDL_mutex* gm, DelayFunc delay_func, MainFrame* mainframe, ColumnGraph* column_graph);
+
+/**
+ * @brief Cycle sort, writing each element at most once.
+ *
+ * Counts the elements smaller than the first unsorted one to find where it
+ * belongs, writes it there and carries on with the element it replaced until
+ * the cycle closes. An element already in place is never written, so the
+ * number of writes is the least any sort can do, for O(n²) comparisons.
+ * Meant for memories where writes cost far more than reads, see
+ * GraphStats_setWriteCost.
+ */
+void Vector_sortCycle(Vector* list, CompareFunc compare_func, SDL_mutex* gm, DelayFunc delay_func, MainFrame* mainframe, ColumnGraph* column_graph);
 
 /**
  * @brief Convert a ListSortType enum value to a human-readable string.
@@ -135,3 +254,11 @@ const char* ListSortType_toString(ListSortType sortType);
  * @return Corresponding ListSortType or LIST_SORT_TYPE_COUNT on unknown input.
  */
 ListSortType ListSortType_fromString(const char* str);
+
+/**
+ * @brief Convert a ShellGapSequence enum value to a human-readable string.
+ *
+ * @param sequence Enum value to convert.
+ * @return Nul-terminated string naming the gap sequence.
+ */
+const char* ShellGapSequence_toString(ShellGapSequence sequence);
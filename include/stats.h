@@ -7,6 +7,13 @@
 
 #include "Settings.h"
 
+/** @brief Number of passes a GraphStats keeps, later passes are only counted in the totals. */
+#define GRAPH_STATS_MAX_PASSES 128
+/** @brief Weight of a write against a read or a comparison in the weighted cost of a sort. */
+#define GRAPH_STATS_DEFAULT_WRITE_COST 1
+/** @brief Highest write cost weight, the weights offered go by powers of two up to it. */
+#define GRAPH_STATS_MAX_WRITE_COST 16
+
 /**
  * @struct GraphStats
  * @brief Aggregated statistics produced by sorting visualizations.
@@ -18,13 +25,22 @@ struct GraphStats {
     Uint32 sort_time;   /**< Total sort time in milliseconds (or platform-defined units). */
     int comparisons;    /**< Number of element comparisons performed. */
     int swaps;          /**< Number of element swaps performed. */
-    int access_memory;  /**< Count of memory access operations recorded. */
+    int access_memory;  /**< Count of memory access operations recorded, reads plus writes. */
+    int reads;          /**< Memory reads among access_memory. */
+    int writes;         /**< Memory writes among access_memory. */
+    int write_cost;     /**< Weight of a write in the weighted cost, kept across resets. */
+    int char_comparisons; /**< Single character comparisons of string sorts, apart from whole-string ones. */
+    size_t aux_bytes;   /**< Heap memory currently held by the sort besides the list itself. */
+    size_t peak_aux_bytes; /**< Highest aux_bytes reached since the last reset. */
+    GraphStatsPass passes[GRAPH_STATS_MAX_PASSES]; /**< Per-pass counters of multi-pass sorts, oldest first. */
+    int pass_count;     /**< Number of passes recorded in passes. */
 };
 
 /**
  * @brief Allocate and initialize a new GraphStats instance.
  *
- * The returned object is zero-initialized and must be freed with GraphStats_destroy.
+ * The returned object is zero-initialized, apart from the write cost set to
+ * GRAPH_STATS_DEFAULT_WRITE_COST, and must be freed with GraphStats_destroy.
  *
  * @return Pointer to a newly allocated GraphStats, or NULL on allocation failure.
  */
@@ -62,12 +78,57 @@ void GraphStats_incrementComparisons(GraphStats* stats);
 void GraphStats_incrementSwaps(GraphStats* stats);
 
 /**
- * @brief Add a given amount to the memory access counter.
+ * @brief Add a given amount to the memory read counter, and to the memory access one.
+ *
+ * @param stats Pointer to the GraphStats to update.
+ * @param amount Number of memory reads to add.
+ */
+void GraphStats_incrementReads(GraphStats* stats, int amount);
+
+/**
+ * @brief Add a given amount to the memory write counter, and to the memory access one.
+ *
+ * @param stats Pointer to the GraphStats to update.
+ * @param amount Number of memory writes to add.
+ */
+void GraphStats_incrementWrites(GraphStats* stats, int amount);
+
+/**
+ * @brief Increment the character comparisons counter by one.
+ *
+ * For string sorts comparing one character at a time, comparisons keeps
+ * counting the whole-string ones.
+ *
+ * @param stats Pointer to the GraphStats to update.
+ */
+void GraphStats_incrementCharComparisons(GraphStats* stats);
+
+/**
+ * @brief Record an auxiliary allocation made by a sort.
+ *
+ * @param stats Pointer to the GraphStats to update.
+ * @param bytes Size of the allocation.
+ */
+void GraphStats_allocAux(GraphStats* stats, size_t bytes);
+
+/**
+ * @brief Record the release of an allocation passed to GraphStats_allocAux.
  *
  * @param stats Pointer to the GraphStats to update.
- * @param amount Number of memory accesses to add (may be negative to subtract).
+ * @param bytes Size of the allocation.
  */
-void GraphStats_incrementAccessMemory(GraphStats* stats, int amount);
+void GraphStats_freeAux(GraphStats* stats, size_t bytes);
+
+/**
+ * @brief Add the counters of \p from to \p into.
+ *
+ * Lets each thread of a parallel sort count on its own stats. Passes and
+ * auxiliary memory are left out.
+ *
+ * @param into Pointer to the GraphStats to update.
+ * @param from Pointer to the GraphStats to add.
+ */
+void GraphStats_merge(GraphStats* into, const GraphStats* from);
 
 /**
  * @brief Get the recorded sort time.
@@ -108,3 +169,99 @@ int GraphStats_getSwaps(GraphStats* stats);
  * @return Memory access count, or 0 if stats is NULL.
  */
 int GraphStats_getAccessMemory(GraphStats* stats);
+
+/**
+ * @brief Get the number of memory reads recorded.
+ *
+ * @param stats Pointer to the GraphStats to query.
+ * @return Memory read count, or 0 if stats is NULL.
+ */
+int GraphStats_getReads(GraphStats* stats);
+
+/**
+ * @brief Get the number of memory writes recorded.
+ *
+ * @param stats Pointer to the GraphStats to query.
+ * @return Memory write count, or 0 if stats is NULL.
+ */
+int GraphStats_getWrites(GraphStats* stats);
+
+/**
+ * @brief Get the weight of a write in the weighted cost.
+ *
+ * @param stats Pointer to the GraphStats to query.
+ * @return Write cost, or GRAPH_STATS_DEFAULT_WRITE_COST if stats is NULL.
+ */
+int GraphStats_getWriteCost(GraphStats* stats);
+
+/**
+ * @brief Set the weight of a write in the weighted cost.
+ *
+ * Lets sorts be compared for memories where writes cost more than reads,
+ * such as flash or non-volatile memory. Kept by GraphStats_reset.
+ *
+ * @param stats Pointer to the GraphStats to update.
+ * @param write_cost Weight of a write, at least 1.
+ */
+void GraphStats_setWriteCost(GraphStats* stats, int write_cost);
+
+/**
+ * @brief Get the weighted cost of the last sort.
+ *
+ * Comparisons and reads count once, writes count write_cost times.
+ *
+ * @param stats Pointer to the GraphStats to query.
+ * @return Weighted cost, or 0 if stats is NULL.
+ */
+long GraphStats_getWeightedCost(GraphStats* stats);
+
+/**
+ * @brief Get the number of character comparisons recorded.
+ *
+ * @param stats Pointer to the GraphStats to query.
+ * @return Number of character comparisons, or 0 if stats is NULL.
+ */
+int GraphStats_getCharComparisons(GraphStats* stats);
+
+/**
+ * @brief Get the most auxiliary memory held at once by the last sort.
+ *
+ * @param stats Pointer to the GraphStats to query.
+ * @return Peak auxiliary bytes, or 0 if stats is NULL.
+ */
+size_t GraphStats_getPeakAuxBytes(GraphStats* stats);
+
+/**
+ * @brief Start recording a new pass of a multi-pass sort.
+ *
+ * The counters keep growing as usual, GraphStats_endPass stores what changed
+ * since this call. Passes past GRAPH_STATS_MAX_PASSES are not recorded.
+ *
+ * @param stats Pointer to the GraphStats to update.
+ * @param gap Distance between compared elements during the pass.
+ */
+void GraphStats_beginPass(GraphStats* stats, long gap);
+
+/**
+ * @brief Finish the pass started by GraphStats_beginPass.
+ *
+ * @param stats Pointer to the GraphStats to update.
+ */
+void GraphStats_endPass(GraphStats* stats);
+
+/**
+ * @brief Get the number of passes recorded since the last reset.
+ *
+ * @param stats Pointer to the GraphStats to query.
+ * @return Number of recorded passes, or 0 if stats is NULL.
+ */
+int GraphStats_getPassCount(GraphStats* stats);
+
+/**
+ * @brief Get a recorded pass.
+ *
+ * @param stats Pointer to the GraphStats to query.
+ * @param index Index of the pass, 0 being the first one.
+ * @return Pointer to the pass, or NULL if stats is NULL or index is out of range.
+ */
+const GraphStatsPass* GraphStats_getPass(GraphStats* stats, int index);
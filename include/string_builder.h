@@ -42,6 +42,17 @@ StringBuilder* StringBuilder_create(size_t init_capacity);
  */
 void StringBuilder_destroy(StringBuilder* builder);
 
+/**
+ * @brief Make room for at least capacity bytes of content without further reallocation.
+ *
+ * Does nothing if the buffer is already large enough.
+ *
+ * @param builder Target builder.
+ * @param capacity Number of content bytes to reserve (excluding the terminating NUL).
+ * @return true on success, false on allocation failure.
+ */
+bool StringBuilder_reserve(StringBuilder* builder, size_t capacity);
+
 /**
  * @brief Append a NUL-terminated C string to the builder.
  *
@@ -66,11 +77,21 @@ void StringBuilder_append_char(StringBuilder* builder, char c);
  */
 void StringBuilder_append_int(StringBuilder* builder, int i);
 
+/**
+ * @brief Append a long (decimal) to the builder.
+ *
+ * Digits are written directly into the buffer without going through printf.
+ *
+ * @param builder Target builder.
+ * @param value Value to append.
+ */
+void StringBuilder_append_long(StringBuilder* builder, long value);
+
 /**
  * @brief Append formatted text using printf-style format.
  *
- * The function handles formatting into a temporary buffer or allocates
- * a dynamic buffer if the formatted result does not fit the stack buffer.
+ * The text is formatted directly at the end of the buffer, which grows once
+ * if the result does not fit the remaining capacity.
  *
  * @param builder Target builder.
  * @param format printf-style format string.
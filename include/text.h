@@ -12,6 +12,7 @@
  * @brief Holds text content, rendering resources and layout information.
  *
  * - text: Owned NUL-terminated string representing the current content.
+ * - capacity: Allocated size of text in bytes, reused by Text_setString when the new content fits.
  * - texture: SDL texture used for rendering the text.
  * - renderer: SDL_Renderer used to create and draw the texture.
  * - position: Position of the text; when fromCenter is true the position is the center.
@@ -22,6 +23,7 @@
  */
 struct Text {
     char* text;
+    size_t capacity;
     SDL_Texture* texture;
     SDL_Renderer* renderer;
     Position* position;
@@ -72,7 +74,9 @@ void Text_destroy(Text* self);
 /**
  * @brief Replace the text content and refresh the texture.
  *
- * The provided string is duplicated. If the content is unchanged the function returns early.
+ * The provided string is copied, into the current buffer when it fits so that
+ * updating a text every frame does not allocate. If the content is unchanged the
+ * function returns early.
  *
  * @param self Text instance to update.
  * @param str New NUL-terminated string.
@@ -90,8 +94,8 @@ void Text_setStringf(Text* self, const char* format, ...);
 /**
  * @brief Set the text color and refresh the texture.
  *
- * Ownership semantics for Color follow the project's conventions (the implementation
- * may transfer ownership or copy as needed).
+ * Takes ownership of \p color. If it matches the current color it is destroyed
+ * right away and the texture is kept, so calling this every frame is cheap.
  *
  * @param self Text instance to update.
  * @param color Color to apply to the text.
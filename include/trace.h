@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2025 Torisutan
+ * ALl rights reserved
+ */
+
+#pragma once
+
+#include "Settings.h"
+
+/**
+ * @brief Maximum number of threads recording at the same time.
+ *
+ * Enough for every graph running a parallel sort on PARALLEL_SORT_MAX_THREADS (64)
+ * threads, plus the sort threads and the main thread. Events are only allocated
+ * for the buffers taken, the others cost a few bytes each.
+ */
+#define TRACE_MAX_THREADS (MAX_GRAPHS * 64 + MAX_GRAPHS + 1)
+/** @brief Events kept per thread, older ones are overwritten. */
+#define TRACE_BUFFER_EVENTS 16384
+/** @brief Maximum length of a thread name shown in the trace. */
+#define TRACE_THREAD_NAME_SIZE 32
+/** @brief Thread names kept per recording, threads named past it show as plain ids. */
+#define TRACE_MAX_THREAD_NAMES (2 * TRACE_MAX_THREADS)
+
+/**
+ * @struct TraceEvent
+ * @brief One begin or end mark of a traced section.
+ *
+ * - name: section name, must be a string literal (only the pointer is stored).
+ * - timestamp: performance counter when the event was recorded.
+ * - tid: id of the thread that recorded it.
+ * - phase: 'B' for begin, 'E' for end, as in the trace event format.
+ */
+struct TraceEvent {
+    const char* name;
+    Uint64 timestamp;
+    SDL_threadID tid;
+    char phase;
+};
+
+/**
+ * @struct TraceBuffer
+ * @brief Ring buffer of events written by a single thread.
+ *
+ * Only the owning thread writes, it publishes each event by bumping head.
+ * The dump reads a snapshot of head without locking. When its thread exits
+ * the buffer is released and can be taken by a new thread, keeping the
+ * events already recorded.
+ *
+ * - events: TRACE_BUFFER_EVENTS slots, allocated on first use.
+ * - head: number of events ever written, the next slot is head % TRACE_BUFFER_EVENTS.
+ * - in_use: 1 while a thread owns the buffer.
+ * - tid / name: owning thread and its name, also kept in the recording's name table.
+ */
+struct TraceBuffer {
+    TraceEvent* events;
+    SDL_atomic_t head;
+    SDL_atomic_t in_use;
+    SDL_threadID tid;
+    char name[TRACE_THREAD_NAME_SIZE];
+};
+
+/**
+ * @struct TraceThreadName
+ * @brief Name of a thread for the trace viewer.
+ *
+ * Kept per thread id rather than per buffer: a buffer taken over by a new
+ * thread still holds events of the previous one, which keep their name.
+ */
+struct TraceThreadName {
+    SDL_threadID tid;
+    char name[TRACE_THREAD_NAME_SIZE];
+};
+
+/**
+ * @brief Trace the statement or block that follows as a section named \p name.
+ *
+ * Usage: TRACE_SCOPE("Render") { Frame_render(frame, renderer); }
+ * Leaving the block with break, continue, return or goto leaves the section open.
+ *
+ * @param name Section name, must be a string literal.
+ */
+#define TRACE_SCOPE(name) \
+    for (int trace_once_ = (Trace_begin(name), 1); trace_once_; trace_once_ = 0, Trace_end(name))
+
+/**
+ * @brief Start recording events on every thread.
+ *
+ * Must be called from the main thread. Each recording starts empty: the
+ * events of the previous one are dropped, so Trace_dump only exports the
+ * current recording.
+ */
+void Trace_start();
+
+/**
+ * @brief Stop recording. Events already recorded are kept for Trace_dump.
+ */
+void Trace_stop();
+
+/**
+ * @brief Whether events are currently being recorded.
+ *
+ * @return true between Trace_start and Trace_stop.
+ */
+bool Trace_isRecording();
+
+/**
+ * @brief Record the beginning of a section on the calling thread.
+ *
+ * Costs a single atomic read when not recording.
+ *
+ * @param name Section name, must be a string literal.
+ */
+void Trace_begin(const char* name);
+
+/**
+ * @brief Record the end of the section opened last on the calling thread.
+ *
+ * @param name Section name, same as given to Trace_begin.
+ */
+void Trace_end(const char* name);
+
+/**
+ * @brief Name the calling thread in the trace viewer.
+ *
+ * Does nothing when not recording.
+ *
+ * @param format printf-style format string.
+ * @param ... Format arguments.
+ */
+void Trace_setThreadName(const char* format, ...);
+
+/**
+ * @brief Write every recorded event to \p path in the trace event JSON format.
+ *
+ * The file opens in chrome://tracing or ui.perfetto.dev. Call it after
+ * Trace_stop, events recorded during the dump may be missing or torn.
+ *
+ * @param path Output file path.
+ * @return true on success, false if the file could not be written.
+ */
+bool Trace_dump(const char* path);
+
+/**
+ * @brief Free every buffer. No thread may record after this call.
+ */
+void Trace_shutdown();
@@ -24,8 +24,40 @@ typedef struct ListIterator ListIterator;
 /** @brief Types of sorting for the list */
 typedef enum ListSortType ListSortType;
 
+/** @brief Contiguous growable array of pointers */
+typedef struct Vector Vector;
+/** @brief Iterator for the growable array */
+typedef struct VectorIterator VectorIterator;
+
+/** @brief Fixed-size object pool backed by a free list */
+typedef struct Pool Pool;
+/** @brief Bump allocator released all at once */
+typedef struct Arena Arena;
+/** @brief Memory block owned by an Arena */
+typedef struct ArenaBlock ArenaBlock;
+
+/** @brief Frame-time profiler and its overlay */
+typedef struct Profiler Profiler;
+/** @brief Timed sections of a main loop iteration */
+typedef enum ProfilerPhase ProfilerPhase;
+/** @brief Begin or end mark recorded by the tracer */
+typedef struct TraceEvent TraceEvent;
+/** @brief Per-thread ring buffer of trace events */
+typedef struct TraceBuffer TraceBuffer;
+/** @brief Name of a traced thread, kept after the thread exits */
+typedef struct TraceThreadName TraceThreadName;
+
+/** @brief Queue of tones from a sort thread to the audio callback */
+typedef struct AudioEventQueue AudioEventQueue;
+/** @brief Tone being synthesized by the audio callback */
+typedef struct AudioVoice AudioVoice;
+/** @brief Shapes of the oscillator wavetables */
+typedef enum Waveform Waveform;
+
 /** @brief Log levels for logging system */
 typedef enum LogLevel LogLevel;
+/** @brief Message waiting in the logger queue */
+typedef struct LogRecord LogRecord;
 
 /** @brief Node of a map (key-value pair) */
 typedef struct MapNode MapNode;
@@ -118,6 +150,20 @@ typedef struct Checkbox Checkbox;
 
 /** @brief Arguments for sorting algorithms */
 typedef struct SortArgs SortArgs;
+/** @brief Arguments of a sort shared by all its threads */
+typedef struct ParallelSortContext ParallelSortContext;
+/** @brief One thread of a parallel sort */
+typedef struct ParallelSortWorker ParallelSortWorker;
+/** @brief Threads of a parallel sort, reused by all its phases */
+typedef struct ParallelSortPool ParallelSortPool;
+/** @brief State of a parallel sample sort */
+typedef struct SampleSort SampleSort;
+/** @brief Ranges left to sort by one thread of the parallel quicksort */
+typedef struct WorkDeque WorkDeque;
+/** @brief State of a parallel quicksort */
+typedef struct ParallelQuickSort ParallelQuickSort;
+/** @brief State of a parallel LSD radix sort */
+typedef struct ParallelRadixSort ParallelRadixSort;
 
 // Frames
 /** @brief The main application frame */
@@ -134,6 +180,37 @@ typedef struct {
     float width, height;
 } Size;
 
+/**
+ * @brief Phase-accumulator oscillator reading a precomputed wavetable (see oscillator.h).
+ *
+ * The phase is a 32-bit fixed-point fraction of a period that wraps around
+ * on overflow; its top OSCILLATOR_TABLE_BITS bits index the table.
+ *
+ * - table: one period of the waveform, values in [-1, 1].
+ * - phase: current position in the period.
+ * - step: phase increment per sample, set from the frequency.
+ */
+typedef struct Oscillator {
+    const float* table;
+    Uint32 phase;
+    Uint32 step;
+} Oscillator;
+
+/**
+ * @brief Counters of one pass of a multi-pass sort (see GraphStats_beginPass).
+ *
+ * - gap: distance between compared elements during the pass.
+ * - comparisons / swaps / access_memory / reads / writes: what the pass alone did.
+ */
+typedef struct GraphStatsPass {
+    long gap;
+    int comparisons;
+    int swaps;
+    int access_memory;
+    int reads;
+    int writes;
+} GraphStatsPass;
+
 /** @brief Column graph styles (colors) */
 typedef enum ColumnGraphStyle {
     GRAPH_RAINBOW,
@@ -160,9 +237,29 @@ typedef enum ListSortType {
     LIST_SORT_TYPE_BOGO,
     LIST_SORT_TYPE_SELECTION,
     LIST_SORT_TYPE_RADIX,
+    LIST_SORT_TYPE_HEAP,
+    LIST_SORT_TYPE_HEAP_QUATERNARY,
+    LIST_SORT_TYPE_SHELL,
+    LIST_SORT_TYPE_COUNTING,
+    LIST_SORT_TYPE_MSD_RADIX,
+    LIST_SORT_TYPE_MULTIKEY_QUICK,
+    LIST_SORT_TYPE_BLOCK_MERGE,
+    LIST_SORT_TYPE_SAMPLE,
+    LIST_SORT_TYPE_PARALLEL_QUICK,
+    LIST_SORT_TYPE_PARALLEL_RADIX,
+    LIST_SORT_TYPE_CYCLE,
     LIST_SORT_TYPE_COUNT
 } ListSortType;
 
+/** @brief Gap sequences available to Shell sort */
+typedef enum ShellGapSequence {
+    SHELL_GAPS_CIURA,
+    SHELL_GAPS_TOKUDA,
+    SHELL_GAPS_SEDGEWICK,
+    SHELL_GAPS_PRATT,
+    SHELL_GAPS_COUNT
+} ShellGapSequence;
+
 
 // Types of func
 /** @brief Function pointer type for event handling */
@@ -184,5 +281,5 @@ typedef bool (*ColumnsHoverFunc)(void* data, void* value, ColumnGraphType type);
 /** @brief Function pointer for comparing two elements */
 typedef int (*CompareFunc)(const void* a, const void* b);
 
-/** @brief Function pointer for delaying between sorting steps */
+/** @brief Function pointer for delaying between sorting steps, called concurrently by the threads of parallel sorts */
 typedef void (*DelayFunc)(MainFrame* self, ColumnGraph* graph, ColumnGraphBar* actual, ColumnGraphBar* second);
\ No newline at end of file
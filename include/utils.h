@@ -35,12 +35,12 @@ struct Color {
  * @brief Allocate and initialize a Position.
  * @param x X coordinate.
  * @param y Y coordinate.
- * @return Pointer to a newly allocated Position (caller must call Position_destroy).
+ * @return Pointer to a Position taken from the Position pool (caller must call Position_destroy, never free).
  */
 Position* Position_new(float x, float y);
 
 /**
- * @brief Free a Position allocated with Position_new.
+ * @brief Give a Position allocated with Position_new back to its pool.
  * @param pos Pointer to the Position to free. Safe to pass NULL.
  */
 void Position_destroy(Position* pos);
@@ -127,7 +127,7 @@ bool Color_equals(const Color* a, const Color* b);
 Color* Color_fromHex(const char* hex);
 
 /**
- * @brief Free a Color previously allocated.
+ * @brief Give a Color back to the Color pool; every Color must be released this way, never with free.
  * @param color Pointer to the Color to free. Safe to pass NULL.
  */
 void Color_destroy(Color* color);
@@ -241,6 +241,25 @@ float String_parseFloat(const char* str, float defaultValue);
  */
 char* String_format(const char* fmt, ...);
 
+/**
+ * @brief Format a string using printf-style formatting into a caller buffer, without allocating.
+ * @param buffer Destination buffer, always NUL-terminated when size > 0.
+ * @param size Size of the buffer in bytes.
+ * @param fmt Format string.
+ * @param ... Format arguments.
+ * @return Length the full string needs (excluding the NUL) as snprintf, or a negative value on error.
+ */
+int String_formatTo(char* buffer, size_t size, const char* fmt, ...);
+
+/**
+ * @brief Write the decimal form of a long into a caller buffer, without going through printf.
+ * @param buffer Destination buffer, always NUL-terminated when size > 0.
+ * @param size Size of the buffer in bytes.
+ * @param value Value to write.
+ * @return Length the full number needs (excluding the NUL), truncated like snprintf if it does not fit.
+ */
+size_t String_fromLong(char* buffer, size_t size, long value);
+
 /**
  * @brief Check whether a string represents a numeric value.
  * @param str Input string.
@@ -279,6 +298,15 @@ int String_compare(const char* a, const char* b);
  */
 char* String_formatTime(Uint32 milliseconds);
 
+/**
+ * @brief Format a millisecond duration like String_formatTime, into a caller buffer without allocating.
+ * @param buffer Destination buffer, always NUL-terminated when size > 0. 32 bytes fit any duration.
+ * @param size Size of the buffer in bytes.
+ * @param milliseconds Time duration in milliseconds.
+ * @return Length the full string needs (excluding the NUL), truncated like snprintf if it does not fit.
+ */
+size_t String_formatTimeTo(char* buffer, size_t size, Uint32 milliseconds);
+
 /**
  * @brief Compute modulo that handles negative dividends in a mathematical sense.
  * @param a Dividend.
@@ -0,0 +1,280 @@
+/*
+ * Copyright (c) 2025 Torisutan
+ * ALl rights reserved
+ */
+
+#pragma once
+
+#include "Settings.h"
+
+#define VECTOR_DEFAULT_CAPACITY 16
+
+/**
+ * @struct Vector
+ * @brief Contiguous, growable array of opaque pointers.
+ *
+ * - data: heap block holding \p capacity slots, the first \p size are in use.
+ * - size: number of elements currently stored.
+ * - capacity: number of allocated slots (grows geometrically).
+ */
+struct Vector {
+    void** data;
+    size_t size;
+    size_t capacity;
+};
+
+/**
+ * @struct VectorIterator
+ * @brief Forward iterator for traversing a Vector.
+ *
+ * Mirrors the ListIterator API so both containers can be walked the same way.
+ *
+ * - vector: iterated vector.
+ * - current: slot of the next element to return.
+ * - index: current index (incremented after returning an element).
+ * - size: snapshot of the vector size at iterator creation.
+ */
+struct VectorIterator {
+    Vector* vector;
+    size_t current;
+    int index;
+    size_t size;
+};
+
+/**
+ * @brief Create and initialize a new empty Vector.
+ *
+ * @return Pointer to newly allocated Vector or NULL on allocation failure.
+ */
+Vector* Vector_create();
+
+/**
+ * @brief Create a new empty Vector with room for \p capacity elements.
+ *
+ * @param capacity Number of slots to reserve up front.
+ * @return Pointer to newly allocated Vector or NULL on allocation failure.
+ */
+Vector* Vector_createWithCapacity(size_t capacity);
+
+/**
+ * @brief Destroy a Vector and free its storage.
+ *
+ * Does not call destructors for stored values. Safe to call with NULL.
+ *
+ * @param vector Pointer to Vector to destroy.
+ */
+void Vector_destroy(Vector* vector);
+
+/**
+ * @brief Destroy the vector and call a destructor for each stored value.
+ *
+ * @param vector Pointer to Vector to destroy.
+ * @param destroy_func Function called for each stored value (may be NULL).
+ */
+void Vector_destroyWithValues(Vector* vector, DestroyFunc destroy_func);
+
+/**
+ * @brief Remove all elements but keep the allocated storage.
+ *
+ * @param vector Pointer to Vector to clear.
+ */
+void Vector_clear(Vector* vector);
+
+/**
+ * @brief Ensure the vector can hold at least \p capacity elements without reallocating.
+ *
+ * @param vector Pointer to Vector.
+ * @param capacity Minimum capacity required.
+ * @return true on success, false if the allocation failed.
+ */
+bool Vector_reserve(Vector* vector, size_t capacity);
+
+/**
+ * @brief Append a value to the end of the vector (amortized O(1)).
+ *
+ * @param vector Pointer to Vector.
+ * @param value Opaque pointer to store.
+ */
+void Vector_push(Vector* vector, void* value);
+
+/**
+ * @brief Remove the first element whose pointer equals \p value, keeping order.
+ *
+ * @param vector Pointer to Vector.
+ * @param value Value pointer to remove.
+ */
+void Vector_remove(Vector* vector, void* value);
+
+/**
+ * @brief Remove and return the value at \p index, keeping order (O(n)).
+ *
+ * @param vector Pointer to Vector.
+ * @param index Zero-based index of element to remove.
+ * @return Stored pointer previously at index or NULL on error.
+ */
+void* Vector_pop(Vector* vector, size_t index);
+
+/**
+ * @brief Convenience macro to pop the last element (O(1)).
+ */
+#define Vector_popLast(vector) Vector_pop(vector, (vector)->size - 1)
+
+/**
+ * @brief Remove and return the value at \p index by moving the last element into its slot (O(1)).
+ *
+ * Does not preserve element order.
+ *
+ * @param vector Pointer to Vector.
+ * @param index Zero-based index of element to remove.
+ * @return Stored pointer previously at index or NULL on error.
+ */
+void* Vector_swapRemove(Vector* vector, size_t index);
+
+/**
+ * @brief Return the number of elements contained in the vector.
+ *
+ * @param vector Pointer to Vector.
+ * @return Number of elements.
+ */
+size_t Vector_size(Vector* vector);
+
+/**
+ * @brief Check whether the vector is empty.
+ *
+ * @param vector Pointer to Vector.
+ * @return true if size == 0, false otherwise.
+ */
+bool Vector_empty(Vector* vector);
+
+/**
+ * @brief Check whether the vector contains a value.
+ *
+ * @param vector Pointer to Vector.
+ * @param value Value to search for.
+ * @param isString Whether to treat values as C strings for comparison.
+ * @return true if found, false otherwise.
+ */
+bool Vector_contains(Vector* vector, void* value, bool isString);
+
+/**
+ * @brief Return the index of the first element whose pointer equals \p value.
+ *
+ * @param vector Pointer to Vector.
+ * @param value Value to search for.
+ * @return Zero-based index or -1 if not found.
+ */
+long Vector_indexOf(Vector* vector, void* value);
+
+/**
+ * @brief Retrieve the value at a given zero-based index (O(1)).
+ *
+ * Returns NULL and logs an error if index is out of bounds.
+ *
+ * @param vector Pointer to Vector.
+ * @param index Index to retrieve.
+ * @return Stored pointer or NULL on error.
+ */
+void* Vector_get(Vector* vector, size_t index);
+
+/**
+ * @brief Retrieve the last element's value.
+ *
+ * @param vector Pointer to Vector.
+ * @return Stored pointer or NULL if the vector is empty.
+ */
+void* Vector_getLast(Vector* vector);
+
+/**
+ * @brief Retrieve the first element's value.
+ *
+ * @param vector Pointer to Vector.
+ * @return Stored pointer or NULL if the vector is empty.
+ */
+void* Vector_getFirst(Vector* vector);
+
+/**
+ * @brief Replace the value stored at the given index (O(1)).
+ *
+ * Does not free the previously stored value.
+ *
+ * @param vector Pointer to Vector.
+ * @param index Index to update.
+ * @param value New value pointer to store.
+ */
+void Vector_set(Vector* vector, size_t index, void* value);
+
+/**
+ * @brief Swap values at two indices.
+ *
+ * @param vector Pointer to Vector.
+ * @param index1 First index.
+ * @param index2 Second index.
+ */
+void Vector_swap(Vector* vector, size_t index1, size_t index2);
+
+/**
+ * @brief Randomly shuffle the vector in-place using an optional PRNG.
+ *
+ * If \p pr is NULL the standard rand() is used.
+ *
+ * @param vector Pointer to Vector.
+ * @param pr Optional PRNG instance.
+ */
+void Vector_shuffle(Vector* vector, PRNG* pr);
+
+/**
+ * @brief Return the maximum element according to \p compare_func.
+ *
+ * @param vector Pointer to Vector.
+ * @param compare_func Comparison function between two stored values.
+ * @return Pointer to the maximum value or NULL if vector is empty.
+ */
+void* Vector_max(Vector* vector, CompareFunc compare_func);
+
+/**
+ * @brief Return the minimum element according to \p compare_func.
+ *
+ * @param vector Pointer to Vector.
+ * @param compare_func Comparison function between two stored values.
+ * @return Pointer to the minimum value or NULL if vector is empty.
+ */
+void* Vector_min(Vector* vector, CompareFunc compare_func);
+
+/**
+ * @brief Create a new iterator for forward traversal of the vector.
+ *
+ * @param vector Pointer to Vector.
+ * @return Newly allocated VectorIterator or NULL on failure.
+ */
+VectorIterator* VectorIterator_new(Vector* vector);
+
+/**
+ * @brief Destroy a VectorIterator.
+ *
+ * @param iterator Pointer to iterator to free. Safe to call with NULL.
+ */
+void VectorIterator_destroy(VectorIterator* iterator);
+
+/**
+ * @brief Check whether the iterator has more elements.
+ *
+ * @param iterator Pointer to VectorIterator.
+ * @return true if a next element is available.
+ */
+bool VectorIterator_hasNext(VectorIterator* iterator);
+
+/**
+ * @brief Return the next element from the iterator.
+ *
+ * @param iterator Pointer to VectorIterator.
+ * @return Next stored value or NULL.
+ */
+void* VectorIterator_next(VectorIterator* iterator);
+
+/**
+ * @brief Return the index of the last returned element by the iterator.
+ *
+ * @param iterator Pointer to VectorIterator.
+ * @return Zero-based index of the last returned element, or -1 if none.
+ */
+int VectorIterator_index(VectorIterator* iterator);
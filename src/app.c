@@ -4,11 +4,13 @@
  */
 #include "app.h"
 
+#include "arena.h"
 #include "frame.h"
 #include "logger.h"
 #include "utils.h"
 #include "input.h"
 #include "list.h"
+#include "profiler.h"
 #include "resource_manager.h"
 #include "style.h"
 
@@ -41,6 +43,25 @@ App* App_create(SDL_Window* window, SDL_Renderer* renderer) {
         safe_free((void**)&app);
         return NULL;
     }
+    app->frame_arena = Arena_create(FRAME_ARENA_SIZE);
+    if (!app->frame_arena) {
+        error("Failed to create frame arena for App");
+        ResourceManager_destroy(app->manager);
+        Input_destroy(app->input);
+        List_destroy(app->stack);
+        safe_free((void**)&app);
+        return NULL;
+    }
+    app->profiler = Profiler_create();
+    if (!app->profiler) {
+        error("Failed to create profiler for App");
+        Arena_destroy(app->frame_arena);
+        ResourceManager_destroy(app->manager);
+        Input_destroy(app->input);
+        List_destroy(app->stack);
+        safe_free((void**)&app);
+        return NULL;
+    }
     app->running = true;
     return app;
 }
@@ -50,6 +71,8 @@ void App_destroy(App* app) {
     Input_destroy(app->input);
     List_destroy(app->stack);
     Theme_destroy(app->theme);
+    Arena_destroy(app->frame_arena);
+    Profiler_destroy(app->profiler);
     safe_free((void**)&app);
 }
 
@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2025 Torisutan
+ * ALl rights reserved
+ */
+#include "arena.h"
+#include "logger.h"
+#include "utils.h"
+
+static ArenaBlock* ArenaBlock_new(size_t capacity, ArenaBlock* next);
+static void Arena_freeBlocks(ArenaBlock* block);
+
+static ArenaBlock* ArenaBlock_new(size_t capacity, ArenaBlock* next) {
+    ArenaBlock* block = malloc(sizeof(ArenaBlock) + capacity);
+    if (!block) {
+        error("Failed to allocate %zu bytes for ArenaBlock", capacity);
+        return NULL;
+    }
+    block->next = next;
+    block->capacity = capacity;
+    block->used = 0;
+    return block;
+}
+
+static void Arena_freeBlocks(ArenaBlock* block) {
+    while (block) {
+        ArenaBlock* next = block->next;
+        free(block);
+        block = next;
+    }
+}
+
+Arena* Arena_create(size_t capacity) {
+    Arena* arena = calloc(1, sizeof(Arena));
+    if (!arena) {
+        error("Failed to allocate memory for Arena");
+        return NULL;
+    }
+    arena->head = ArenaBlock_new(capacity, NULL);
+    if (!arena->head) {
+        safe_free((void**)&arena);
+        return NULL;
+    }
+    return arena;
+}
+
+void Arena_destroy(Arena* arena) {
+    if (!arena) return;
+    Arena_freeBlocks(arena->head);
+    safe_free((void**)&arena);
+}
+
+void* Arena_alloc(Arena* arena, size_t size) {
+    size = (size + ARENA_ALIGNMENT - 1) & ~(size_t) (ARENA_ALIGNMENT - 1);
+    ArenaBlock* block = arena->head;
+    if (block->used + size > block->capacity) {
+        size_t capacity = block->capacity * 2;
+        if (capacity < size) capacity = size;
+        block = ArenaBlock_new(capacity, arena->head);
+        if (!block) return NULL;
+        arena->head = block;
+    }
+    void* ptr = block->data + block->used;
+    block->used += size;
+    return ptr;
+}
+
+char* Arena_strdup(Arena* arena, const char* str) {
+    if (!str) return NULL;
+    size_t len = strlen(str) + 1;
+    char* copy = Arena_alloc(arena, len);
+    if (copy) {
+        memcpy(copy, str, len);
+    }
+    return copy;
+}
+
+char* Arena_format(Arena* arena, const char* format, ...) {
+    va_list args;
+    va_start(args, format);
+    int size = vsnprintf(NULL, 0, format, args);
+    va_end(args);
+    if (size < 0) {
+        error("Arena_format: vsnprintf failed");
+        return NULL;
+    }
+    char* buffer = Arena_alloc(arena, (size_t) size + 1);
+    if (!buffer) return NULL;
+    va_start(args, format);
+    vsnprintf(buffer, (size_t) size + 1, format, args);
+    va_end(args);
+    return buffer;
+}
+
+void Arena_reset(Arena* arena) {
+    size_t used = Arena_used(arena);
+    if (used > arena->peak) arena->peak = used;
+    if (arena->head->next) {
+        // The frame overflowed: replace the chain by one block fitting the whole peak.
+        size_t capacity = 0;
+        for (ArenaBlock* block = arena->head; block; block = block->next) {
+            capacity += block->capacity;
+        }
+        ArenaBlock* merged = ArenaBlock_new(capacity, NULL);
+        if (merged) {
+            Arena_freeBlocks(arena->head);
+            arena->head = merged;
+            return;
+        }
+        // Keep the chain if the merged block can't be allocated, it's still valid memory.
+        for (ArenaBlock* block = arena->head; block; block = block->next) {
+            block->used = 0;
+        }
+        return;
+    }
+    arena->head->used = 0;
+}
+
+size_t Arena_used(const Arena* arena) {
+    size_t used = 0;
+    for (ArenaBlock* block = arena->head; block; block = block->next) {
+        used += block->used;
+    }
+    return used;
+}
@@ -5,96 +5,258 @@
 #include "audio.h"
 
 #include "logger.h"
+#include "oscillator.h"
 #include "utils.h"
 
-Mix_Chunk* Audio_createNoise(int frequency, int duration_ms) {
-    const int sample_rate = 44100;
-    int samples = (duration_ms * sample_rate) / 1000;
+static AudioEventQueue audio_queues[MAX_GRAPHS];
+static AudioVoice audio_voices[AUDIO_VOICES];
+static SDL_atomic_t audio_enabled;
+static bool audio_started;
+static int audio_sample_rate;
+static int audio_channels;
 
-    int16_t* buffer = malloc(samples * sizeof(int16_t));
-    if (!buffer) {
-        error("Failed to allocate memory for audio buffer");
-        return NULL;
+static bool Audio_querySpec(int* sample_rate, int* channels);
+static Sint16* Audio_allocFrames(int duration_ms, int* frames, int* sample_rate, int* channels);
+static Mix_Chunk* Audio_newChunk(Sint16* buffer, int frames, int channels);
+static void Audio_startVoice(float frequency, int delay);
+static void Audio_drainQueue(AudioEventQueue* queue, int frames);
+static void Audio_mix(void* data, Uint8* stream, int len);
+
+// Spec of the open mixer device: chunks are played as is, so they must match it.
+static bool Audio_querySpec(int* sample_rate, int* channels) {
+    if (audio_started) {
+        *sample_rate = audio_sample_rate;
+        *channels = audio_channels;
+        return true;
+    }
+    Uint16 format;
+    if (!Mix_QuerySpec(sample_rate, &format, channels)) {
+        log_message(LOG_LEVEL_WARN, "Audio output not open: %s", Mix_GetError());
+        return false;
     }
+    if (format != AUDIO_S16SYS) {
+        log_message(LOG_LEVEL_WARN, "Unsupported audio format 0x%x", format);
+        return false;
+    }
+    return true;
+}
+
+static Sint16* Audio_allocFrames(int duration_ms, int* frames, int* sample_rate, int* channels) {
+    if (!Audio_querySpec(sample_rate, channels)) return NULL;
+    *frames = (int) ((long) duration_ms * *sample_rate / 1000);
+    if (*frames <= 0) return NULL;
 
-    for (int i = 0; i < samples; i++) {
-        const int16_t amplitude = 28000;
-        double time = (double)i / sample_rate;
-        buffer[i] = (int16_t)(amplitude * sin(2.0 * M_PI * frequency * time));
+    // Allocated with SDL_malloc: Mix_FreeChunk releases it with SDL_free once the chunk owns it.
+    Sint16* buffer = SDL_malloc((size_t) *frames * (size_t) *channels * sizeof(Sint16));
+    if (!buffer) {
+        error("Failed to allocate memory for audio buffer");
     }
+    return buffer;
+}
 
-    Mix_Chunk* chunk = Mix_QuickLoad_RAW((Uint8*)buffer, samples * sizeof(int16_t));
+static Mix_Chunk* Audio_newChunk(Sint16* buffer, int frames, int channels) {
+    Mix_Chunk* chunk = Mix_QuickLoad_RAW((Uint8*)buffer, (Uint32) ((size_t) frames * (size_t) channels * sizeof(Sint16)));
     if (!chunk) {
         error("Failed to create Mix_Chunk: %s", Mix_GetError());
-        safe_free((void**)&buffer);
+        SDL_free(buffer);
         return NULL;
     }
-
-    safe_free((void**)&buffer);
+    // Mix_QuickLoad_RAW only references the buffer, it must outlive the chunk.
+    chunk->allocated = 1;
     return chunk;
 }
 
+Mix_Chunk* Audio_createTone(Waveform waveform, int frequency, int duration_ms) {
+    int frames, sample_rate, channels;
+    Sint16* buffer = Audio_allocFrames(duration_ms, &frames, &sample_rate, &channels);
+    if (!buffer) return NULL;
+
+    Oscillator oscillator;
+    Oscillator_init(&oscillator, waveform, (float) frequency, sample_rate);
+    for (int i = 0; i < frames; i++) {
+        Sint16 sample = (Sint16) (Oscillator_next(&oscillator) * AUDIO_AMPLITUDE);
+        for (int c = 0; c < channels; c++) {
+            buffer[i * channels + c] = sample;
+        }
+    }
+    return Audio_newChunk(buffer, frames, channels);
+}
+
+Mix_Chunk* Audio_createNoise(int frequency, int duration_ms) {
+    return Audio_createTone(WAVEFORM_SINE, frequency, duration_ms);
+}
+
 void Audio_play(Mix_Chunk* chunk, int volume, bool loop) {
+    if (!chunk) return;
     Mix_VolumeChunk(chunk, volume);
     int loops = loop ? -1 : 0;
     if (Mix_PlayChannel(-1, chunk, loops) == -1) {
         error("Failed to play audio chunk: %s", Mix_GetError());
-        Mix_FreeChunk(chunk);
-        return;
     }
+}
+
+Mix_Chunk* Audio_createSweep(int start_freq, int end_freq, int duration_ms) {
+    int frames, sample_rate, channels;
+    Sint16* buffer = Audio_allocFrames(duration_ms, &frames, &sample_rate, &channels);
+    if (!buffer) return NULL;
+
+    Oscillator oscillator;
+    Oscillator_init(&oscillator, WAVEFORM_SINE, (float) start_freq, sample_rate);
+    for (int i = 0; i < frames; i++) {
+        float t = frames > 1 ? (float) i / (float) (frames - 1) : 0.f;
+        float frequency = (float) start_freq + (float) (end_freq - start_freq) * t;
+        if (frequency < 1.f) frequency = 1.f;
+        Oscillator_setFrequency(&oscillator, frequency, sample_rate);
+        Sint16 sample = (Sint16) (Oscillator_next(&oscillator) * AUDIO_AMPLITUDE);
+        for (int c = 0; c < channels; c++) {
+            buffer[i * channels + c] = sample;
+        }
+    }
+    return Audio_newChunk(buffer, frames, channels);
+}
+
+// Last sweep played, freed when the next one replaces it or when the sound stops.
+static Mix_Chunk* audio_sweep;
+static int audio_sweep_channel = -1;
 
-    SDL_Delay(chunk->alen / (44100 * sizeof(int16_t)) * 1000 + 50);
-    Mix_FreeChunk(chunk);
+static void Audio_freeSweep() {
+    if (!audio_sweep) return;
+    if (audio_sweep_channel >= 0 && Mix_GetChunk(audio_sweep_channel) == audio_sweep) {
+        Mix_HaltChannel(audio_sweep_channel);
+    }
+    Mix_FreeChunk(audio_sweep);
+    audio_sweep = NULL;
+    audio_sweep_channel = -1;
 }
 
 void Audio_playSweepingNoise(int start_freq, int end_freq, int duration_ms) {
-    const int sample_rate = 44100;
-    const int16_t amplitude = 28000;
-    int64_t samples = (int64_t)duration_ms * sample_rate / 1000;
-    if (samples <= 0) return;
+    Mix_Chunk* sweep = Audio_createSweep(start_freq, end_freq, duration_ms);
+    if (!sweep) return;
+    Audio_freeSweep();
+    audio_sweep = sweep;
+    audio_sweep_channel = Mix_PlayChannel(-1, sweep, 0);
+    if (audio_sweep_channel == -1) {
+        error("Failed to play audio chunk: %s", Mix_GetError());
+    }
+}
 
-    int16_t *buffer = malloc(samples * sizeof(int16_t));
-    if (!buffer) return;
+bool Audio_startSonification() {
+    if (audio_started) return true;
+    int sample_rate;
+    int channels;
+    if (!Audio_querySpec(&sample_rate, &channels)) {
+        log_message(LOG_LEVEL_WARN, "Sort sounds disabled");
+        return false;
+    }
+    Oscillator_initTables();
+    audio_sample_rate = sample_rate;
+    audio_channels = channels;
+    memset(audio_voices, 0, sizeof(audio_voices));
+    Mix_SetPostMix(Audio_mix, NULL);
+    audio_started = true;
+    return true;
+}
 
-    double phase = 0.0;
-    const double two_pi = 2.0 * M_PI;
-    double fs = (double)sample_rate;
+void Audio_stopSonification() {
+    Audio_freeSweep();
+    if (!audio_started) return;
+    SDL_AtomicSet(&audio_enabled, 0);
+    // SDL_mixer swaps the hook under the audio lock, the callback is done once this returns.
+    Mix_SetPostMix(NULL, NULL);
+    audio_started = false;
+}
 
-    for (int64_t i = 0; i < samples; ++i) {
-        double t = (double)i / (double)(samples - 1); /* 0..1 */
-        double fc = (double)start_freq + (double)(end_freq - start_freq) * t;
-        if (fc < 1.0) fc = 1.0;
+void Audio_setSonification(bool enabled) {
+    if (!audio_started) return;
+    SDL_AtomicSet(&audio_enabled, enabled ? 1 : 0);
+    log_message(LOG_LEVEL_DEBUG, "Sort sounds %s", enabled ? "enabled" : "disabled");
+}
 
-        /* intégrer la phase : phase += 2*pi*fc/fs */
-        phase += two_pi * fc / fs;
-        if (phase > two_pi) phase = fmod(phase, two_pi);
+bool Audio_isSonificationEnabled() {
+    return SDL_AtomicGet(&audio_enabled) != 0;
+}
 
-        double sample = sin(phase) * amplitude;
-        if (sample > INT16_MAX) sample = INT16_MAX;
-        if (sample < INT16_MIN) sample = INT16_MIN;
-        buffer[i] = (int16_t)sample;
+void Audio_pushTone(int graph_index, float value) {
+    if (!SDL_AtomicGet(&audio_enabled) || graph_index < 0 || graph_index >= MAX_GRAPHS) return;
+    AudioEventQueue* queue = &audio_queues[graph_index];
+    if (!SDL_AtomicTryLock(&queue->producer)) return;
+    unsigned int head = (unsigned int) SDL_AtomicGet(&queue->head);
+    if (head - (unsigned int) SDL_AtomicGet(&queue->tail) < AUDIO_EVENT_QUEUE_SIZE) {
+        if (value < 0.f) value = 0.f;
+        if (value > 1.f) value = 1.f;
+        // Exponential mapping: equal value steps sound like equal intervals.
+        queue->frequencies[head & (AUDIO_EVENT_QUEUE_SIZE - 1)] =
+            AUDIO_MIN_FREQUENCY * powf(AUDIO_MAX_FREQUENCY / AUDIO_MIN_FREQUENCY, value);
+        SDL_AtomicSet(&queue->head, (int) (head + 1));
     }
+    SDL_AtomicUnlock(&queue->producer);
+}
 
-    SDL_AudioSpec want, have;
-    SDL_zero(want);
-    want.freq = sample_rate;
-    want.format = AUDIO_S16SYS;
-    want.channels = 1;
-    want.samples = 4096;
-
-    SDL_InitSubSystem(SDL_INIT_AUDIO);
-    SDL_AudioDeviceID dev = SDL_OpenAudioDevice(NULL, 0, &want, &have, 0);
-    if (dev == 0) {
-        free(buffer);
-        return;
+static void Audio_startVoice(float frequency, int delay) {
+    AudioVoice* voice = &audio_voices[0];
+    for (int i = 0; i < AUDIO_VOICES; i++) {
+        if (!audio_voices[i].active) {
+            voice = &audio_voices[i];
+            break;
+        }
+        if (audio_voices[i].age > voice->age) {
+            voice = &audio_voices[i];
+        }
     }
+    voice->active = true;
+    Oscillator_init(&voice->oscillator, AUDIO_TONE_WAVEFORM, frequency, audio_sample_rate);
+    voice->delay = delay;
+    voice->age = 0;
+    voice->length = audio_sample_rate * AUDIO_TONE_MS / 1000;
+}
 
-    SDL_ClearQueuedAudio(dev);
-    SDL_QueueAudio(dev, buffer, (uint32_t)(samples * sizeof(int16_t)));
-    SDL_PauseAudioDevice(dev, 0);
+static void Audio_drainQueue(AudioEventQueue* queue, int frames) {
+    unsigned int tail = (unsigned int) SDL_AtomicGet(&queue->tail);
+    unsigned int head = (unsigned int) SDL_AtomicGet(&queue->head);
+    unsigned int count = head - tail;
+    if (count == 0) return;
+    // A fast sort pushes far more steps than can be heard: play a few, spread over the buffer.
+    unsigned int played = count < AUDIO_TONES_PER_MIX ? count : AUDIO_TONES_PER_MIX;
+    for (unsigned int k = 0; k < played; k++) {
+        float frequency = queue->frequencies[(tail + k * count / played) & (AUDIO_EVENT_QUEUE_SIZE - 1)];
+        Audio_startVoice(frequency, (int) (k * (unsigned int) frames / played));
+    }
+    SDL_AtomicSet(&queue->tail, (int) head);
+}
 
-    SDL_Delay(duration_ms + 100);
+// Runs on the audio thread after SDL_mixer has mixed its channels into stream.
+static void Audio_mix(void* data, Uint8* stream, int len) {
+    (void) data;
+    Sint16* samples = (Sint16*) stream;
+    int frames = len / (int) sizeof(Sint16) / audio_channels;
+    if (SDL_AtomicGet(&audio_enabled)) {
+        for (int i = 0; i < MAX_GRAPHS; i++) {
+            Audio_drainQueue(&audio_queues[i], frames);
+        }
+    }
 
-    SDL_CloseAudioDevice(dev);
-    free(buffer);
+    for (int v = 0; v < AUDIO_VOICES; v++) {
+        AudioVoice* voice = &audio_voices[v];
+        if (!voice->active) continue;
+        int attack = voice->length / 10;
+        for (int f = 0; f < frames; f++) {
+            if (voice->delay > 0) {
+                voice->delay--;
+                continue;
+            }
+            if (voice->age >= voice->length) {
+                voice->active = false;
+                break;
+            }
+            float envelope = voice->age < attack
+                ? (float) voice->age / (float) attack
+                : (float) (voice->length - voice->age) / (float) (voice->length - attack);
+            int sample = (int) (Oscillator_next(&voice->oscillator) * envelope * envelope * AUDIO_TONE_AMPLITUDE);
+            voice->age++;
+            for (int c = 0; c < audio_channels; c++) {
+                int mixed = samples[f * audio_channels + c] + sample;
+                samples[f * audio_channels + c] = (Sint16) (mixed > INT16_MAX ? INT16_MAX : mixed < INT16_MIN ? INT16_MIN : mixed);
+            }
+        }
+    }
 }
@@ -11,7 +11,6 @@
 #include "geometry.h"
 #include "input.h"
 #include "layout.h"
-#include "list.h"
 #include "logger.h"
 #include "random.h"
 #include "resource_manager.h"
@@ -21,9 +20,14 @@
 #include "text.h"
 #include "timer.h"
 #include "utils.h"
+#include "vector.h"
+
+#define COLUMN_GRAPH_STATS_LINES 4
+#define COLUMN_GRAPH_STATS_LINE_SIZE 48
 
-static void ColumnGraph_handleMouseMotion(Input* input, SDL_Event* evt, ColumnGraph* graph);
 static void ColumnGraph_initGraphStatsContainer(ColumnGraph* graph);
+static void ColumnGraph_formatStat(char* line, const char* label, long value);
+static void ColumnGraph_formatStats(ColumnGraph* graph, char lines[COLUMN_GRAPH_STATS_LINES][COLUMN_GRAPH_STATS_LINE_SIZE]);
 
 ColumnGraph* ColumnGraph_new(float width, float height, Position* position, App* app, void* parent, ColumnGraphType type, ColumnsHoverFunc onHover, ColumnsHoverFunc offHover, int index, int seed) {
     ColumnGraph* graph = calloc(1, sizeof(ColumnGraph));
@@ -42,22 +46,47 @@ ColumnGraph* ColumnGraph_new(float width, float height, Position* position, App*
     graph->stats = GraphStats_new();
     graph->sort_timer = Timer_new();
     graph->sort_type = LIST_SORT_TYPE_BUBBLE;
-    graph->bars = List_create();
+    graph->shell_gaps = SHELL_GAPS_CIURA;
+    graph->bars = Vector_create();
     graph->onHover = onHover;
     graph->offHover = offHover;
     graph->prng = seed >= 0 ? PRNG_init(seed) : NULL;
     graph->container = FlexContainer_new(position->x, position->y, width, height);
     FlexContainer_setAlignItems(graph->container, NO_FLEX_ALIGN);
 
-    Input_addEventHandler(app->input, SDL_MOUSEMOTION, (EventHandlerFunc) ColumnGraph_handleMouseMotion, graph);
     ColumnGraph_initGraphStatsContainer(graph);
     return graph;
 }
 
+// Label followed by the value, both short enough for a stats line.
+static void ColumnGraph_formatStat(char* line, const char* label, long value) {
+    size_t len = strlen(label);
+    memcpy(line, label, len);
+    String_fromLong(line + len, COLUMN_GRAPH_STATS_LINE_SIZE - len, value);
+}
+
+// Formatted on the stack: refreshed every frame, it must not allocate.
+static void ColumnGraph_formatStats(ColumnGraph* graph, char lines[COLUMN_GRAPH_STATS_LINES][COLUMN_GRAPH_STATS_LINE_SIZE]) {
+    memcpy(lines[0], "Sort Time: ", sizeof("Sort Time: "));
+    String_formatTimeTo(lines[0] + sizeof("Sort Time: ") - 1, COLUMN_GRAPH_STATS_LINE_SIZE - sizeof("Sort Time: ") + 1,
+                        graph->stats->sort_time);
+    ColumnGraph_formatStat(lines[1], "Comparisons: ", graph->stats->comparisons);
+    ColumnGraph_formatStat(lines[2], "Swaps: ", graph->stats->swaps);
+    // Two numbers of at most 11 characters each, the line always fits.
+    size_t len = sizeof("Reads / Writes: ") - 1;
+    memcpy(lines[3], "Reads / Writes: ", len);
+    len += String_fromLong(lines[3] + len, COLUMN_GRAPH_STATS_LINE_SIZE - len, graph->stats->reads);
+    memcpy(lines[3] + len, " / ", sizeof(" / "));
+    len += sizeof(" / ") - 1;
+    String_fromLong(lines[3] + len, COLUMN_GRAPH_STATS_LINE_SIZE - len, graph->stats->writes);
+}
+
 static void ColumnGraph_initGraphStatsContainer(ColumnGraph* graph) {
     if (graph->stats_container) {
         Container_destroy(graph->stats_container);
     }
+    graph->stats_bounds = (SDL_FRect) {graph->position->x, graph->position->y, graph->size.width, graph->size.height};
+    graph->stats_sort_type = graph->sort_type;
     graph->stats_container = Container_new(graph->position->x, graph->position->y, fminf(275.f, graph->size.width / 2.5f), fminf(150.f, graph->size.height / 2.f), false, Color_rgba(0, 0, 0, 150), graph);
     bool max_width = graph->stats_container->box->size.width == 250.f;
     UNUSED(max_width);
@@ -80,57 +109,29 @@ static void ColumnGraph_initGraphStatsContainer(ColumnGraph* graph) {
     int y_offset = max_height ? 10 : graph->stats_container->box->size.height < 100.f ? 0 : 5;
     int font_size = max_height ? 14 : graph->stats_container->box->size.height < 100.f ? 12 : 13;
     TextStyle* stat_text_style = TextStyle_new(ResourceManager_getDefaultFont(graph->app->manager, font_size), font_size, COLOR_WHITE, TTF_STYLE_NORMAL);
-    Text* sort_time_text = Text_newf(graph->app->renderer,
-        stat_text_style,
-        Position_new(graph->position->x + 10, y),
-        false,
-        "Sort Time: %s", String_formatTime(graph->stats->sort_time));
-    text_size = Text_getSize(sort_time_text);
-    y += text_size.height + y_offset;
-
-    Text* comparisons_text = Text_newf(graph->app->renderer,
-        TextStyle_deepCopy(stat_text_style),
-        Position_new(graph->position->x + 10, y),
-        false,
-        "Comparisons: %d", graph->stats->comparisons);
-    text_size = Text_getSize(comparisons_text);
-    y += text_size.height + y_offset;
-
-    Text* swaps_text = Text_newf(graph->app->renderer,
-        TextStyle_deepCopy(stat_text_style),
-        Position_new(graph->position->x + 10, y),
-        false,
-        "Swaps: %d", graph->stats->swaps);
-    text_size = Text_getSize(swaps_text);
-    y += text_size.height + y_offset;
-
-    Text* access_memory_text = Text_newf(graph->app->renderer,
-        TextStyle_deepCopy(stat_text_style),
-        Position_new(graph->position->x + 10, y),
-        false,
-        "Memory Access: %d", graph->stats->access_memory);
-
-    Container_addChild(graph->stats_container, Element_fromText(sort_time_text, NULL));
-    Container_addChild(graph->stats_container, Element_fromText(comparisons_text, NULL));
-    Container_addChild(graph->stats_container, Element_fromText(swaps_text, NULL));
-    Container_addChild(graph->stats_container, Element_fromText(access_memory_text, NULL));
+    char lines[COLUMN_GRAPH_STATS_LINES][COLUMN_GRAPH_STATS_LINE_SIZE];
+    ColumnGraph_formatStats(graph, lines);
+    for (int i = 0; i < COLUMN_GRAPH_STATS_LINES; i++) {
+        Text* text = Text_new(graph->app->renderer,
+            i == 0 ? stat_text_style : TextStyle_deepCopy(stat_text_style),
+            Position_new(graph->position->x + 10, y),
+            false,
+            lines[i]);
+        text_size = Text_getSize(text);
+        y += text_size.height + y_offset;
+        graph->stats_texts[i] = text;
+        Container_addChild(graph->stats_container, Element_fromText(text, NULL));
+    }
 }
 
 void ColumnGraph_destroy(ColumnGraph* graph) {
     if (!graph) return;
-    ListIterator* it = ListIterator_new(graph->bars);
-    while (ListIterator_hasNext(it)) {
-        ColumnGraphBar* bar = (ColumnGraphBar*)ListIterator_next(it);
-        ColumnGraphBar_destroy(bar);
-    }
-    Input_removeOneEventHandler(graph->app->input, SDL_MOUSEMOTION, graph);
-    ListIterator_destroy(it);
-    List_destroy(graph->bars);
+    Vector_destroyWithValues(graph->bars, (DestroyFunc) ColumnGraphBar_destroy);
     FlexContainer_destroy(graph->container);
     if (graph->stats_container) {
         Container_destroy(graph->stats_container);
     }
-    safe_free((void**)&graph->position);
+    Position_destroy(graph->position);
     safe_free((void**)&graph);
 }
 
@@ -139,7 +140,16 @@ void ColumnGraph_update(ColumnGraph* graph) {
     if (graph->sort_in_progress) {
         GraphStats_setSortTime(graph->stats, Timer_getTicks(graph->sort_timer));
     }
-    ColumnGraph_initGraphStatsContainer(graph);
+    SDL_FRect bounds = {graph->position->x, graph->position->y, graph->size.width, graph->size.height};
+    if (memcmp(&bounds, &graph->stats_bounds, sizeof(SDL_FRect)) != 0 || graph->sort_type != graph->stats_sort_type) {
+        ColumnGraph_initGraphStatsContainer(graph);
+        return;
+    }
+    char lines[COLUMN_GRAPH_STATS_LINES][COLUMN_GRAPH_STATS_LINE_SIZE];
+    ColumnGraph_formatStats(graph, lines);
+    for (int i = 0; i < COLUMN_GRAPH_STATS_LINES; i++) {
+        Text_setString(graph->stats_texts[i], lines[i]);
+    }
 }
 
 void ColumnGraph_initBars(ColumnGraph* graph, const int bars_count, void** values, ColumnGraphStyle style) {
@@ -151,13 +161,10 @@ void ColumnGraph_initBars(ColumnGraph* graph, const int bars_count, void** value
     Color** colors = ColumnGraph_getDefaultColors(style, &numColors);
 
     if (graph->bars) {
-        ListIterator *it = ListIterator_new(graph->bars);
-        while (ListIterator_hasNext(it)) {
-            ColumnGraphBar* bar = (ColumnGraphBar*)ListIterator_next(it);
-            ColumnGraphBar_destroy(bar);
+        for (size_t i = 0; i < Vector_size(graph->bars); i++) {
+            ColumnGraphBar_destroy(Vector_get(graph->bars, i));
         }
-        ListIterator_destroy(it);
-        List_clear(graph->bars);
+        Vector_clear(graph->bars);
     }
 
     void* max;
@@ -174,6 +181,7 @@ void ColumnGraph_initBars(ColumnGraph* graph, const int bars_count, void** value
     }
     if (max == NULL) return;
 
+    Vector_reserve(graph->bars, bars_count);
     for (int i = 0; i < bars_count; i++) {
         float t = (bars_count <= 1) ? 0.0f : (float)i / (float)(bars_count - 1);
         float pos = t * (numColors - 1);
@@ -188,7 +196,7 @@ void ColumnGraph_initBars(ColumnGraph* graph, const int bars_count, void** value
         }
 
         ColumnGraphBar* graph_bar = ColumnGraphBar_new(values[i], grad, graph->size.height, (void*)max, graph);
-        List_push(graph->bars, graph_bar);
+        Vector_push(graph->bars, graph_bar);
         FlexContainer_addElement(graph->container, graph_bar->element, 1.f, 1.f, -1.f);
     }
     FlexContainer_layout(graph->container);
@@ -218,7 +226,7 @@ void ColumnGraph_initBarsColored(ColumnGraph* graph, int bars_count, void** valu
 
     for (int i = 0; i < bars_count; i++) {
         ColumnGraphBar* graph_bar = ColumnGraphBar_new(values[i], colors[i], graph->size.height, (void*)max, graph);
-        List_push(graph->bars, graph_bar);
+        Vector_push(graph->bars, graph_bar);
         FlexContainer_addElement(graph->container, graph_bar->element, 1.f, 1.f, -1.f);
     }
     FlexContainer_layout(graph->container);
@@ -246,50 +254,49 @@ void ColumnGraph_setGraphType(ColumnGraph* graph, ColumnGraphType type) {
 
 void ColumnGraph_shuffleBars(ColumnGraph* graph) {
     if (!graph) return;
-    List_shuffle(graph->bars, graph->prng);
+    Vector_shuffle(graph->bars, graph->prng);
     FlexContainer_clear(graph->container);
-    ListIterator* it = ListIterator_new(graph->bars);
-    while (ListIterator_hasNext(it)) {
-        ColumnGraphBar* bar = (ColumnGraphBar*)ListIterator_next(it);
+    for (size_t i = 0; i < Vector_size(graph->bars); i++) {
+        ColumnGraphBar* bar = Vector_get(graph->bars, i);
         FlexContainer_addElement(graph->container, bar->element, 1.f, 1.f, -1.f);
     }
     FlexContainer_layout(graph->container);
-    ListIterator_destroy(it);
 }
 
 void ColumnGraph_resetContainer(ColumnGraph* graph) {
     if (!graph) return;
     FlexContainer_clear(graph->container);
-    ListIterator* it = ListIterator_new(graph->bars);
-    while (ListIterator_hasNext(it)) {
-        ColumnGraphBar* bar = (ColumnGraphBar*)ListIterator_next(it);
+    for (size_t i = 0; i < Vector_size(graph->bars); i++) {
+        ColumnGraphBar* bar = Vector_get(graph->bars, i);
         if (bar) {
             FlexContainer_addElement(graph->container, bar->element, 1.f, 1.f, -1.f);
         }
     }
     FlexContainer_layout(graph->container);
-    ListIterator_destroy(it);
 }
 
 void ColumnGraph_sortGraph(ColumnGraph* graph, SDL_mutex* gm, DelayFunc delay_func, MainFrame* main_frame) {
     if (!graph) return;
     GraphStats_reset(graph->stats);
     Timer_start(graph->sort_timer);
-    List_sort(graph->bars, graph->sort_type, ColumnGraphBar_compare, gm, delay_func, main_frame, graph);
+    Vector_sort(graph->bars, graph->sort_type, ColumnGraphBar_compare, gm, delay_func, main_frame, graph);
     Timer_stop(graph->sort_timer);
+    log_message(LOG_LEVEL_INFO, "Graph %d (%s): %d comparisons, %d reads, %d writes, weighted cost %ld (writes x%d)",
+                graph->graph_index + 1, ListSortType_toString(graph->sort_type),
+                GraphStats_getComparisons(graph->stats), GraphStats_getReads(graph->stats),
+                GraphStats_getWrites(graph->stats), GraphStats_getWeightedCost(graph->stats),
+                GraphStats_getWriteCost(graph->stats));
     FlexContainer_clear(graph->container);
-    ListIterator* it = ListIterator_new(graph->bars);
-    while (ListIterator_hasNext(it)) {
-        ColumnGraphBar* bar = (ColumnGraphBar*)ListIterator_next(it);
+    for (size_t i = 0; i < Vector_size(graph->bars); i++) {
+        ColumnGraphBar* bar = Vector_get(graph->bars, i);
         FlexContainer_addElement(graph->container, bar->element, 1.f, 1.f, -1.f);
     }
     FlexContainer_layout(graph->container);
-    ListIterator_destroy(it);
 }
 
 void ColumnGraph_removeHovering(ColumnGraph* graph) {
     if (!graph || !graph->hoveredBar) return;
-    graph->hoveredBar->element->data.box->background = Color_copy(graph->hoveredBar->color);
+    ColumnGraphBar_setHighlighted(graph->hoveredBar, false);
     graph->hovered = false;
     graph->hoveredBar = NULL;
     if (graph->offHover) {
@@ -312,12 +319,10 @@ void ColumnGraph_renderBar(ColumnGraph* graph, int w, int h) {
     void** values = ColumnGraph_getValues(graph, &val_count);
     if (!values) return;
 
-    ListIterator* it = ListIterator_new(graph->bars);
-    while (ListIterator_hasNext(it)) {
-        ColumnGraphBar_destroy(ListIterator_next(it));
+    for (size_t i = 0; i < Vector_size(graph->bars); i++) {
+        ColumnGraphBar_destroy(Vector_get(graph->bars, i));
     }
-    ListIterator_destroy(it);
-    List_clear(graph->bars);
+    Vector_clear(graph->bars);
     ColumnGraph_initBars(graph, val_count, values, graph->graph_style);
 
     safe_free((void**)&values);
@@ -325,10 +330,9 @@ void ColumnGraph_renderBar(ColumnGraph* graph, int w, int h) {
 
 void ColumnGraph_render(ColumnGraph* graph, SDL_Renderer* renderer) {
     if (!graph || !renderer) return;
-    ListIterator* it = ListIterator_new(graph->bars);
     int index = 0;
-    while (ListIterator_hasNext(it)) {
-        ColumnGraphBar* bar = (ColumnGraphBar*)ListIterator_next(it);
+    for (size_t i = 0; i < Vector_size(graph->bars); i++) {
+        ColumnGraphBar* bar = Vector_get(graph->bars, i);
         if (!bar) {
             continue;
         }
@@ -340,7 +344,6 @@ void ColumnGraph_render(ColumnGraph* graph, SDL_Renderer* renderer) {
         Element_render(bar->element, renderer);
         index++;
     }
-    ListIterator_destroy(it);
     Container_render(graph->stats_container, renderer);
 }
 
@@ -349,20 +352,17 @@ void** ColumnGraph_getValues(ColumnGraph* graph, int* out_len) {
         *out_len = 0;
         return NULL;
     }
-    int count = List_size(graph->bars);
+    int count = Vector_size(graph->bars);
     void** values = calloc(count, sizeof(void*));
     if (!values) {
         error("Failed to allocate memory for ColumnGraph values");
         *out_len = 0;
         return NULL;
     }
-    ListIterator* it = ListIterator_new(graph->bars);
-    int index = 0;
-    while (ListIterator_hasNext(it)) {
-        ColumnGraphBar* bar = (ColumnGraphBar*)ListIterator_next(it);
-        values[index++] = bar->value;
+    for (int i = 0; i < count; i++) {
+        ColumnGraphBar* bar = Vector_get(graph->bars, i);
+        values[i] = bar->value;
     }
-    ListIterator_destroy(it);
     *out_len = count;
     return values;
 }
@@ -372,20 +372,17 @@ Color** ColumnGraph_getColors(ColumnGraph* graph, int* out_len) {
         *out_len = 0;
         return NULL;
     };
-    int count = List_size(graph->bars);
+    int count = Vector_size(graph->bars);
     Color** colors = calloc(count, sizeof(Color*));
     if (!colors) {
         error("Failed to allocate memory for ColumnGraph colors");
         *out_len = 0;
         return NULL;
     }
-    ListIterator* it = ListIterator_new(graph->bars);
-    int index = 0;
-    while (ListIterator_hasNext(it)) {
-        ColumnGraphBar* bar = (ColumnGraphBar*)ListIterator_next(it);
-        colors[index++] = Color_copy(bar->color);
+    for (int i = 0; i < count; i++) {
+        ColumnGraphBar* bar = Vector_get(graph->bars, i);
+        colors[i] = Color_copy(bar->color);
     }
-    ListIterator_destroy(it);
     *out_len = count;
 
     return colors;
@@ -394,12 +391,10 @@ Color** ColumnGraph_getColors(ColumnGraph* graph, int* out_len) {
 void ColumnGraph_resetBars(ColumnGraph* graph) {
     if (!graph) return;
     FlexContainer_clear(graph->container);
-    ListIterator* it = ListIterator_new(graph->bars);
-    while (ListIterator_hasNext(it)) {
-        ColumnGraphBar_destroy(ListIterator_next(it));
+    for (size_t i = 0; i < Vector_size(graph->bars); i++) {
+        ColumnGraphBar_destroy(Vector_get(graph->bars, i));
     }
-    ListIterator_destroy(it);
-    List_clear(graph->bars);
+    Vector_clear(graph->bars);
 }
 
 void ColumnGraph_setSortType(ColumnGraph* graph, ListSortType sort_type) {
@@ -407,6 +402,11 @@ void ColumnGraph_setSortType(ColumnGraph* graph, ListSortType sort_type) {
     graph->sort_type = sort_type;
 }
 
+void ColumnGraph_setShellGaps(ColumnGraph* graph, ShellGapSequence shell_gaps) {
+    if (!graph) return;
+    graph->shell_gaps = shell_gaps;
+}
+
 static float ColumnGraphBar_calculateBarHeight(void* value, float height, void* max_value, ColumnGraphType type) {
     switch (type) {
         case GRAPH_TYPE_INT:
@@ -446,46 +446,49 @@ void ColumnGraphBar_setValue(ColumnGraphBar* bar, void* value) {
     bar->value = value;
 }
 
-static void ColumnGraph_handleMouseMotion(Input* input, SDL_Event* evt, ColumnGraph* graph) {
-    if (!graph || graph->sort_in_progress) return;
-    UNUSED(evt);
-    ListIterator* it = ListIterator_new(graph->bars);
-    while (ListIterator_hasNext(it)) {
-        ColumnGraphBar* bar = (ColumnGraphBar*)ListIterator_next(it);
-        Box* box = bar->element->data.box;
-        SDL_FRect rect = { box->position->x, box->position->y, box->size.width, box->size.height };
-        if (Input_mouseInRect(input, rect)) {
-            if (graph->hovered) {
-                graph->hovered = false;
-                graph->hoveredBar->element->data.box->background = Color_copy(graph->hoveredBar->color);
-                graph->hoveredBar = NULL;
-                if (graph->offHover) {
-                    graph->offHover(graph->parent, 0, graph->type);
-                }
-            }
-            graph->hovered = true;
-            bar->element->data.box->background = Color_copy(ColumnGraph_getHoverColor(graph->graph_style));
-            graph->hoveredBar = bar;
-            if (graph->onHover) {
-                if (!graph->onHover(graph->parent, bar->value, graph->type)) {
-                    bar->element->data.box->background = Color_copy(bar->color);
-                    graph->hovered = false;
-                    graph->hoveredBar = NULL;
-                }
-            }
-            ListIterator_destroy(it);
-            return;
-        }
+ColumnGraphBar* ColumnGraph_getBarAt(ColumnGraph* graph, float x, float y) {
+    if (!graph || graph->bars_count <= 0) return NULL;
+    float slot_width = graph->size.width / graph->bars_count;
+    if (slot_width <= 0 || x < graph->position->x || y < graph->position->y) return NULL;
+    // Bars are laid out side by side in equal slots, so the slot index is the bar index.
+    size_t index = (size_t) ((x - graph->position->x) / slot_width);
+    if (index >= Vector_size(graph->bars)) return NULL;
+    ColumnGraphBar* bar = Vector_get(graph->bars, index);
+    Box* box = bar->element->data.box;
+    if (x < box->position->x || x >= box->position->x + box->size.width
+        || y < box->position->y || y >= box->position->y + box->size.height) {
+        return NULL;
     }
+    return bar;
+}
+
+void ColumnGraph_handleMouseMotion(ColumnGraph* graph, float x, float y) {
+    if (!graph || graph->sort_in_progress) return;
+    ColumnGraphBar* bar = ColumnGraph_getBarAt(graph, x, y);
     if (graph->hovered) {
+        ColumnGraph_removeHovering(graph);
+    }
+    if (!bar) return;
+    graph->hovered = true;
+    ColumnGraphBar_setHighlighted(bar, true);
+    graph->hoveredBar = bar;
+    if (graph->onHover && !graph->onHover(graph->parent, bar->value, graph->type)) {
+        ColumnGraphBar_setHighlighted(bar, false);
         graph->hovered = false;
-        graph->hoveredBar->element->data.box->background = Color_copy(graph->hoveredBar->color);
         graph->hoveredBar = NULL;
-        if (graph->offHover) {
-            graph->offHover(graph->parent, 0, graph->type);
-        }
     }
-    ListIterator_destroy(it);
+}
+
+void ColumnGraphBar_setHighlighted(ColumnGraphBar* bar, bool highlighted) {
+    if (!bar) return;
+    Box* box = bar->element->data.box;
+    Color* color = highlighted ? ColumnGraph_getHoverColor(bar->parent->graph_style) : bar->color;
+    // Overwrite the box color in place: hovering and sort highlights happen far too often to allocate.
+    if (box->background) {
+        *box->background = *color;
+    } else {
+        box->background = Color_copy(color);
+    }
 }
 
 int ColumnGraphBar_compare(const void* a, const void* b) {
@@ -575,19 +578,24 @@ char* ColumnGraph_getStyleName(ColumnGraphStyle style) {
 }
 
 Color* ColumnGraph_getHoverColor(ColumnGraphStyle style) {
+    // Static so that hovering and sort highlights never allocate.
+    static Color white = { 255, 255, 255, 255 };
+    static Color black = { 0, 0, 0, 255 };
+    static Color red = { 255, 0, 0, 255 };
+    static Color blue = { 0, 0, 255, 255 };
     switch (style) {
         case GRAPH_RAINBOW:
-            return COLOR_WHITE;
+            return &white;
         case GRAPH_WHITE:
-            return COLOR_BLACK;
+            return &black;
         case GRAPH_BLACK:
-            return COLOR_WHITE;
+            return &white;
         case GRAPH_GRAY:
-            return COLOR_RED;;
+            return &red;
         case GRAPH_BLACK_AND_WHITE:
-            return COLOR_BLUE;
+            return &blue;
         default:
-            return COLOR_WHITE;
+            return &white;
     }
 }
 
@@ -7,8 +7,12 @@
 #include "element.h"
 #include "geometry.h"
 #include "logger.h"
+#include "map.h"
 #include "utils.h"
-#include "list.h"
+#include "vector.h"
+
+static bool Container_renderLayer(Container* container, SDL_Renderer* renderer);
+static int SDLCALL Container_onRenderReset(void* data, SDL_Event* evt);
 
 Container* Container_new(float x, float y, float width, float height, bool from_center, Color* color, void* parent) {
     Container* container = calloc(1, sizeof(Container));
@@ -17,7 +21,8 @@ Container* Container_new(float x, float y, float width, float height, bool from_
         return NULL;
     }
     container->box = Box_new(width, height, 0, Position_new(x, y), color, NULL, from_center);
-    container->children = List_create();
+    container->children = Vector_create();
+    container->children_by_id = Map_create(true);
     container->parent = parent;
 
     return container;
@@ -26,29 +31,138 @@ Container* Container_new(float x, float y, float width, float height, bool from_
 void Container_destroy(Container* container) {
     if (!container) return;
 
+    if (container->cache_layer) {
+        SDL_DelEventWatch(Container_onRenderReset, container);
+    }
+    if (container->layer) {
+        SDL_DestroyTexture(container->layer);
+    }
     Box_destroy(container->box);
-    List_destroyWitValues(container->children, (DestroyFunc)Element_destroy);
+    Map_destroy(container->children_by_id);
+    Vector_destroyWithValues(container->children, (DestroyFunc)Element_destroy);
     safe_free((void**)&container);
 }
 
 void Container_addChild(Container* container, Element* child) {
     if (!container || !child) return;
-    List_push(container->children, child);
+    Element_pushToList(container->children, container->children_by_id, child);
+    container->layer_dirty = true;
 }
 
 void Container_removeChild(Container* container, Element* child) {
     if (!container || !child) return;
-    List_remove(container->children, child);
+    Element_removeFromList(container->children, container->children_by_id, child);
+    container->layer_dirty = true;
+}
+
+Element* Container_getChildById(Container* container, const char* id) {
+    if (!container) return NULL;
+    return Element_getById(container->children_by_id, id);
 }
 
 void Container_render(Container* container, SDL_Renderer* renderer) {
     if (!container || !renderer) return;
 
+    if (container->cache_layer && Container_renderLayer(container, renderer)) return;
+
     Box_render(container->box, renderer);
 
     Element_renderList(container->children, renderer);
 }
 
+static bool Container_renderLayer(Container* container, SDL_Renderer* renderer) {
+    float x, y;
+    Box_getPosition(container->box, &x, &y);
+    int width = (int) ceilf(container->box->size.width);
+    int height = (int) ceilf(container->box->size.height);
+    if (width <= 0 || height <= 0) return false;
+
+    if (container->layer && container->layer_lost) {
+        SDL_DestroyTexture(container->layer);
+        container->layer = NULL;
+    }
+    container->layer_lost = false;
+    if (container->layer) {
+        int layer_width, layer_height;
+        SDL_QueryTexture(container->layer, NULL, NULL, &layer_width, &layer_height);
+        if (layer_width != width || layer_height != height) {
+            SDL_DestroyTexture(container->layer);
+            container->layer = NULL;
+        }
+    }
+    if (!container->layer) {
+        container->layer = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET, width, height);
+        if (!container->layer) {
+            log_message(LOG_LEVEL_WARN, "Cannot create container layer, falling back to direct rendering: %s", SDL_GetError());
+            Container_setCacheLayer(container, false);
+            return false;
+        }
+        // Blending onto a transparent target leaves premultiplied colors in the layer.
+        SDL_SetTextureBlendMode(container->layer, SDL_ComposeCustomBlendMode(
+            SDL_BLENDFACTOR_ONE, SDL_BLENDFACTOR_ONE_MINUS_SRC_ALPHA, SDL_BLENDOPERATION_ADD,
+            SDL_BLENDFACTOR_ONE, SDL_BLENDFACTOR_ONE_MINUS_SRC_ALPHA, SDL_BLENDOPERATION_ADD));
+        container->layer_dirty = true;
+    }
+
+    if (container->layer_dirty) {
+        SDL_Texture* target = SDL_GetRenderTarget(renderer);
+        SDL_Rect saved_viewport;
+        SDL_RenderGetViewport(renderer, &saved_viewport);
+
+        SDL_SetRenderTarget(renderer, container->layer);
+        SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
+        SDL_SetRenderDrawColor(renderer, 0, 0, 0, 0);
+        SDL_RenderClear(renderer);
+        // Children use window coordinates: shift the viewport so the box corner lands on the layer origin.
+        SDL_Rect viewport = {-(int) x, -(int) y, (int) x + width, (int) y + height};
+        SDL_RenderSetViewport(renderer, &viewport);
+        Box_render(container->box, renderer);
+        Element_renderList(container->children, renderer);
+
+        SDL_SetRenderTarget(renderer, target);
+        SDL_RenderSetViewport(renderer, &saved_viewport);
+        container->layer_dirty = false;
+    }
+
+    SDL_FRect dst = {x, y, width, height};
+    SDL_RenderCopyF(renderer, container->layer, NULL, &dst);
+    return true;
+}
+
+static int SDLCALL Container_onRenderReset(void* data, SDL_Event* evt) {
+    Container* container = data;
+    // Render targets lose their pixels on these events; a device reset also invalidates the texture itself.
+    if (evt->type == SDL_RENDER_TARGETS_RESET) {
+        container->layer_dirty = true;
+    } else if (evt->type == SDL_RENDER_DEVICE_RESET) {
+        container->layer_dirty = true;
+        container->layer_lost = true;
+    }
+    return 1;
+}
+
+void Container_setCacheLayer(Container* container, bool enabled) {
+    if (!container) return;
+
+    if (enabled && !container->cache_layer) {
+        SDL_AddEventWatch(Container_onRenderReset, container);
+    } else if (!enabled && container->cache_layer) {
+        SDL_DelEventWatch(Container_onRenderReset, container);
+    }
+    container->cache_layer = enabled;
+    container->layer_dirty = true;
+    if (!enabled && container->layer) {
+        SDL_DestroyTexture(container->layer);
+        container->layer = NULL;
+    }
+}
+
+void Container_markDirty(Container* container) {
+    if (!container) return;
+
+    container->layer_dirty = true;
+}
+
 void Container_update(Container* container) {
     if (!container) return;
 
@@ -71,6 +185,7 @@ void Container_setSize(Container* container, float width, float height) {
     if (!container) return;
 
     container->box->size = (Size) {width, height};
+    container->layer_dirty = true;
 }
 
 Position* Container_getPosition(Container* container) {
@@ -5,16 +5,17 @@
 #include "element.h"
 
 #include "logger.h"
+#include "map.h"
 #include "button.h"
 #include "checkbox.h"
 #include "container.h"
 #include "geometry.h"
 #include "image.h"
 #include "input_box.h"
-#include "list.h"
 #include "select.h"
 #include "text.h"
 #include "utils.h"
+#include "vector.h"
 
 Element* Element_fromButton(Button* button, const char* id) {
     Element* element = calloc(1, sizeof(Element));
@@ -179,9 +180,9 @@ void Element_destroy(Element* element) {
     safe_free((void**)&element);
 }
 
-void Element_destroyList(List* list) {
+void Element_destroyList(Vector* list) {
     if (!list) return;
-    List_destroyWitValues(list, (DestroyFunc) Element_destroy);
+    Vector_destroyWithValues(list, (DestroyFunc) Element_destroy);
 }
 
 
@@ -316,53 +317,60 @@ void Element_unfocus(Element* element) {
 }
 
 
-void Element_renderList(List* list, SDL_Renderer* renderer) {
-    ListIterator* iterator = ListIterator_new(list);
-    while (ListIterator_hasNext(iterator)) {
-        Element* element = ListIterator_next(iterator);
+void Element_renderList(Vector* list, SDL_Renderer* renderer) {
+    for (size_t i = 0; i < Vector_size(list); i++) {
+        Element* element = Vector_get(list, i);
         Element_render(element, renderer);
     }
-    ListIterator_destroy(iterator);
 }
 
-void Element_updateList(List* list) {
-    ListIterator* iterator = ListIterator_new(list);
-    while (ListIterator_hasNext(iterator)) {
-        Element* element = ListIterator_next(iterator);
+void Element_updateList(Vector* list) {
+    for (size_t i = 0; i < Vector_size(list); i++) {
+        Element* element = Vector_get(list, i);
         Element_update(element);
     }
-    ListIterator_destroy(iterator);
 }
 
-void Element_focusList(List* list) {
-    ListIterator* iterator = ListIterator_new(list);
-    while (ListIterator_hasNext(iterator)) {
-        Element* element = ListIterator_next(iterator);
+void Element_focusList(Vector* list) {
+    for (size_t i = 0; i < Vector_size(list); i++) {
+        Element* element = Vector_get(list, i);
         Element_focus(element);
     }
-    ListIterator_destroy(iterator);
 }
 
-void Element_unfocusList(List* list) {
-    ListIterator* iterator = ListIterator_new(list);
-    while (ListIterator_hasNext(iterator)) {
-        Element* element = ListIterator_next(iterator);
+void Element_unfocusList(Vector* list) {
+    for (size_t i = 0; i < Vector_size(list); i++) {
+        Element* element = Vector_get(list, i);
         Element_unfocus(element);
     }
-    ListIterator_destroy(iterator);
 }
 
-Element* Element_getById(List* list, const char* id) {
-    ListIterator* iterator = ListIterator_new(list);
-    while (ListIterator_hasNext(iterator)) {
-        Element* element = ListIterator_next(iterator);
-        if (String_equals(element->id, id)) {
-            ListIterator_destroy(iterator);
-            return element;
+void Element_pushToList(Vector* list, Map* index, Element* element) {
+    if (!list || !element) return;
+    Vector_push(list, element);
+    if (index && element->id && !Map_containsKey(index, element->id)) {
+        Map_put(index, element->id, element);
+    }
+}
+
+void Element_removeFromList(Vector* list, Map* index, Element* element) {
+    if (!list || !element) return;
+    Vector_remove(list, element);
+    if (!index || !element->id || Map_get(index, element->id) != element) return;
+    Map_remove(index, element->id);
+    // Hand the id over to the next element sharing it, if any.
+    for (size_t i = 0; i < Vector_size(list); i++) {
+        Element* other = Vector_get(list, i);
+        if (String_equals(other->id, element->id)) {
+            Map_put(index, other->id, other);
+            break;
         }
     }
-    ListIterator_destroy(iterator);
-    return NULL;
+}
+
+Element* Element_getById(Map* index, const char* id) {
+    if (!index || !id) return NULL;
+    return Map_get(index, (void*)id);
 }
 
 char* ElementType_toString(ElementType type) {
@@ -12,12 +12,13 @@
 #include "geometry.h"
 #include "image.h"
 #include "input.h"
-#include "list.h"
 #include "logger.h"
+#include "map.h"
 #include "resource_manager.h"
 #include "style.h"
 #include "text.h"
 #include "utils.h"
+#include "vector.h"
 
 #define MAX_KEY_SHOW 8
 
@@ -33,9 +34,12 @@ HelpFrame* HelpFrame_new(App *app) {
     }
 
     self->app = app;
-    self->elements = List_create();
-    if (!self->elements) {
+    self->elements = Vector_create();
+    self->elements_by_id = Map_create(true);
+    if (!self->elements || !self->elements_by_id) {
         error("Failed to create elements list for HelpFrame");
+        Vector_destroy(self->elements);
+        Map_destroy(self->elements_by_id);
         safe_free((void **) &self);
         return NULL;
     }
@@ -50,13 +54,11 @@ HelpFrame* HelpFrame_new(App *app) {
 }
 
 static void HelpFrame_addElements(HelpFrame *self, App *app, int curr_page) {
-    ListIterator *it = ListIterator_new(self->elements);
-    while (ListIterator_hasNext(it)) {
-        Element *element = ListIterator_next(it);
-        Element_destroy(element);
+    for (size_t i = 0; i < Vector_size(self->elements); i++) {
+        Element_destroy(Vector_get(self->elements, i));
     }
-    ListIterator_destroy(it);
-    List_clear(self->elements);
+    Vector_clear(self->elements);
+    Map_clear(self->elements_by_id);
 
     int w, h;
     SDL_GetWindowSize(app->window, &w, &h);
@@ -66,48 +68,63 @@ static void HelpFrame_addElements(HelpFrame *self, App *app, int curr_page) {
         POSITION_NULL, true, "Help");
     Size size = Text_getSize(title);
     Text_setPosition(title,  w / 2, size.height / 2 + 5);
-    List_push(self->elements, Element_fromText(title, NULL));
+    Element_pushToList(self->elements, self->elements_by_id, Element_fromText(title, NULL));
 
     int idx = 0;
-    List_push(self->elements, Element_fromContainer(
+    Element_pushToList(self->elements, self->elements_by_id, Element_fromContainer(
         HelpFrame_createKeyContainer(self, "ESC", "Open / Close the setting panel", idx++, curr_page), NULL));
 
-    List_push(self->elements, Element_fromContainer(
+    Element_pushToList(self->elements, self->elements_by_id, Element_fromContainer(
         HelpFrame_createKeyContainer(self, "Space", "Launch the sort (shuffle if graph are already sorted)", idx++, curr_page), NULL));
 
-    List_push(self->elements, Element_fromContainer(
+    Element_pushToList(self->elements, self->elements_by_id, Element_fromContainer(
             HelpFrame_createKeyContainer(self, "H", "Open the help page", idx++, curr_page), NULL));
 
-    List_push(self->elements, Element_fromContainer(
+    Element_pushToList(self->elements, self->elements_by_id, Element_fromContainer(
         HelpFrame_createKeyContainer(self, "S", "Shuffle the graph", idx++, curr_page), NULL));
 
-    List_push(self->elements, Element_fromContainer(
+    Element_pushToList(self->elements, self->elements_by_id, Element_fromContainer(
         HelpFrame_createKeyContainer(self, "P", String_format("Add a graph (maximum : %d)", MAX_GRAPHS), idx++, curr_page), NULL));
 
-    List_push(self->elements, Element_fromContainer(
+    Element_pushToList(self->elements, self->elements_by_id, Element_fromContainer(
         HelpFrame_createKeyContainer(self, "M", "Remove a graph (minimum : 1)", idx++, curr_page), NULL));
 
-    List_push(self->elements, Element_fromContainer(
+    Element_pushToList(self->elements, self->elements_by_id, Element_fromContainer(
         HelpFrame_createKeyContainer(self, "A", "Select all the graph / Select only one graph", idx++, curr_page), NULL));
 
-    List_push(self->elements, Element_fromContainer(
+    Element_pushToList(self->elements, self->elements_by_id, Element_fromContainer(
         HelpFrame_createKeyContainer(self, "I", "Show info of a graph", idx++,curr_page) , NULL));
 
-    List_push(self->elements, Element_fromContainer(
+    Element_pushToList(self->elements, self->elements_by_id, Element_fromContainer(
+        HelpFrame_createKeyContainer(self, "Shift + I", "Change the write cost weight of a graph", idx++, curr_page), NULL));
+
+    Element_pushToList(self->elements, self->elements_by_id, Element_fromContainer(
             HelpFrame_createKeyContainer(self, "O", "Change the sort type of the graph", idx++, curr_page), NULL));
 
-    List_push(self->elements, Element_fromContainer(
+    Element_pushToList(self->elements, self->elements_by_id, Element_fromContainer(
+            HelpFrame_createKeyContainer(self, "Shift + O", "Change the gap sequence of Shell sort", idx++, curr_page), NULL));
+
+    Element_pushToList(self->elements, self->elements_by_id, Element_fromContainer(
             HelpFrame_createKeyContainer(self, "B", "Pause the graph if sorting", idx++, curr_page), NULL));
 
-    List_push(self->elements, Element_fromContainer(
+    Element_pushToList(self->elements, self->elements_by_id, Element_fromContainer(
             HelpFrame_createKeyContainer(self, "Shift + S", "Change the seed of a graph", idx++, curr_page), NULL));
 
-    List_push(self->elements, Element_fromContainer(
+    Element_pushToList(self->elements, self->elements_by_id, Element_fromContainer(
             HelpFrame_createKeyContainer(self, "Tab", "Open a popup for selecting sort type", idx++, curr_page), NULL));
 
-    List_push(self->elements, Element_fromContainer(
+    Element_pushToList(self->elements, self->elements_by_id, Element_fromContainer(
             HelpFrame_createKeyContainer(self, "Shift + Space", "Create and launch multiple graph with different sort type", idx++, curr_page), NULL));
 
+    Element_pushToList(self->elements, self->elements_by_id, Element_fromContainer(
+            HelpFrame_createKeyContainer(self, "N", "Play / Mute the sound of the sorts", idx++, curr_page), NULL));
+
+    Element_pushToList(self->elements, self->elements_by_id, Element_fromContainer(
+            HelpFrame_createKeyContainer(self, "F3", "Show / Hide the frame-time profiler", idx++, curr_page), NULL));
+
+    Element_pushToList(self->elements, self->elements_by_id, Element_fromContainer(
+            HelpFrame_createKeyContainer(self, "F4", "Start / Stop recording a trace file", idx++, curr_page), NULL));
+
     self->max_page = ceilf((float)(idx - 1) / MAX_KEY_SHOW);
 
     Image* left_arrow = Image_load(app, "left-arrow.svg", Position_new(w / 2 - 150, h - 80), false);
@@ -121,15 +138,16 @@ static void HelpFrame_addElements(HelpFrame *self, App *app, int curr_page) {
                               POSITION_NULL, true, "Page %d/%d", curr_page, self->max_page);
     Text_setPosition(page_text, w / 2, h -  50);
 
-    List_push(self->elements, Element_fromText(page_text, NULL));
-    List_push(self->elements, Element_fromImage(left_arrow, "left-arrow"));
-    List_push(self->elements, Element_fromImage(right_arrow, "right-arrow"));
+    Element_pushToList(self->elements, self->elements_by_id, Element_fromText(page_text, NULL));
+    Element_pushToList(self->elements, self->elements_by_id, Element_fromImage(left_arrow, "left-arrow"));
+    Element_pushToList(self->elements, self->elements_by_id, Element_fromImage(right_arrow, "right-arrow"));
 
 }
 
 void HelpFrame_destroy(HelpFrame *self) {
     if (!self) return;
 
+    Map_destroy(self->elements_by_id);
     Element_destroyList(self->elements);
 
     Input_removeOneEventHandler(self->app->input, SDL_MOUSEBUTTONDOWN, self);
@@ -206,6 +224,9 @@ static Container* HelpFrame_createKeyContainer(HelpFrame* self, const char* key,
     Container_addChild(container, Element_fromBox(key_box, NULL));
     Container_addChild(container, Element_fromText(key_text, NULL));
     Container_addChild(container, Element_fromText(description_text, NULL));
+    // Static rows: render once into a layer. The layer clips to the box, so make it fit the description.
+    Container_setSize(container, fmaxf(720, boxWidth + 20 + desc_size.width + 10), boxHeight);
+    Container_setCacheLayer(container, true);
 
     return container;
 }
@@ -213,7 +234,7 @@ static Container* HelpFrame_createKeyContainer(HelpFrame* self, const char* key,
 static void HelpFrame_checkClickArrows(Input* input, SDL_Event* evt, HelpFrame* self) {
     UNUSED(evt);
 
-    Image* left_arrow = Element_getById(self->elements, "left-arrow")->data.image;
+    Image* left_arrow = Element_getById(self->elements_by_id, "left-arrow")->data.image;
     Size left_size = Image_getSize(left_arrow);
     SDL_FRect left_rect = {
         left_arrow->position->x,
@@ -230,7 +251,7 @@ static void HelpFrame_checkClickArrows(Input* input, SDL_Event* evt, HelpFrame*
         return;
     }
 
-    Image* right_arrow = Element_getById(self->elements, "right-arrow")->data.image;
+    Image* right_arrow = Element_getById(self->elements_by_id, "right-arrow")->data.image;
     Size right_size = Image_getSize(right_arrow);
     SDL_FRect right_rect = {
         right_arrow->position->x,
@@ -56,7 +56,7 @@ Image* Image_load(App* app, const char* path, Position* position, bool from_cent
 
 void Image_destroy(Image* self) {
     if (!self) return;
-    safe_free((void**)&self->position);
+    Position_destroy(self->position);
     safe_free((void**)&self);
 }
 
@@ -9,34 +9,40 @@
 #include "map.h"
 #include "utils.h"
 
+INLINE void KeySet_set(Uint64* set, SDL_Scancode key) {
+    set[key >> 6] |= (Uint64) 1 << (key & 63);
+}
+
+INLINE void KeySet_clear(Uint64* set, SDL_Scancode key) {
+    set[key >> 6] &= ~((Uint64) 1 << (key & 63));
+}
+
+INLINE bool KeySet_test(const Uint64* set, SDL_Scancode key) {
+    if ((unsigned) key >= SDL_NUM_SCANCODES) return false;
+    return (set[key >> 6] >> (key & 63)) & 1;
+}
+
 Input* Input_create() {
     Input *input = calloc(1, sizeof(Input));
     if (!input) {
         error("Failed to allocate memory for Input");
         return NULL;
     }
-    input->keysDown = List_create();
-    if (!input->keysDown) {
-        error("Failed to create keysDown list");
-        safe_free((void **) &input);
-        return NULL;
-    }
     input->eventHandlers = Map_create(false);
     if (!input->eventHandlers) {
         error("Failed to create eventHandlers map");
-        List_destroy(input->keysDown);
         safe_free((void **) &input);
         return NULL;
     }
     input->keyEventHandlers = Map_create(false);
     if (!input->keyEventHandlers) {
         error("Failed to create keyEventHandlers map");
-        List_destroy(input->keysDown);
         Map_destroy(input->eventHandlers);
         safe_free((void **) &input);
         return NULL;
     }
-    input->mousePos = Position_new(-1, -1);
+    input->mouse_x = -1;
+    input->mouse_y = -1;
     input->lastPressed = SDL_SCANCODE_UNKNOWN;
     return input;
 }
@@ -44,8 +50,6 @@ Input* Input_create() {
 void Input_destroy(Input *input) {
     if (!input) return;
 
-    List_destroy(input->keysDown);
-
     if (input->eventHandlers) {
         MapIterator *it = MapIterator_new(input->eventHandlers);
         while (MapIterator_hasNext(it)) {
@@ -85,16 +89,18 @@ void Input_destroy(Input *input) {
         Map_destroy(input->keyEventHandlers);
     }
 
-    Position_destroy(input->mousePos);
     safe_free((void **) &input);
 }
 
 void Input_update(Input *input) {
     SDL_Event evt;
     SDL_Scancode code;
+    // Edges only live for the frame they happened in.
+    memset(input->keysPressed, 0, sizeof(input->keysPressed));
+    memset(input->keysReleased, 0, sizeof(input->keysReleased));
     while (SDL_PollEvent(&evt)) {
-        if (input->eventHandlers && Map_containsKey(input->eventHandlers, (void *) (unsigned long) evt.type)) {
-            List *handlers = Map_get(input->eventHandlers, (void *) (unsigned long) evt.type);
+        List *handlers = input->eventHandlers ? Map_get(input->eventHandlers, (void *) (unsigned long) evt.type) : NULL;
+        if (handlers) {
             ListIterator *it = ListIterator_new(handlers);
             while (ListIterator_hasNext(it)) {
                 if (it->size != List_size(handlers)) {
@@ -112,8 +118,8 @@ void Input_update(Input *input) {
                 input->quit = true;
                 break;
             case SDL_KEYDOWN:
-                if (input->keyEventHandlers && Map_containsKey(input->keyEventHandlers, (void *) (unsigned long) evt.key.keysym.scancode)) {
-                    List *handlers = Map_get(input->keyEventHandlers, (void *) (unsigned long) evt.key.keysym.scancode);
+                handlers = input->keyEventHandlers ? Map_get(input->keyEventHandlers, (void *) (unsigned long) evt.key.keysym.scancode) : NULL;
+                if (handlers) {
                     ListIterator *it = ListIterator_new(handlers);
                     while (ListIterator_hasNext(it)) {
                         if (it->size != List_size(handlers)) {
@@ -128,7 +134,11 @@ void Input_update(Input *input) {
                 }
                 code = evt.key.keysym.scancode;
                 input->lastPressed = code;
-                List_push(input->keysDown, (void *) code);
+                if ((unsigned) code < SDL_NUM_SCANCODES && !KeySet_test(input->keysDown, code)) {
+                    // Auto-repeat keeps sending KEYDOWN: only the first one is a press.
+                    KeySet_set(input->keysDown, code);
+                    KeySet_set(input->keysPressed, code);
+                }
                 if (code == SDL_SCANCODE_LSHIFT || code == SDL_SCANCODE_RSHIFT) {
                     input->shift = true;
                 } else if (code == SDL_SCANCODE_LCTRL || code == SDL_SCANCODE_RCTRL) {
@@ -142,7 +152,10 @@ void Input_update(Input *input) {
                 break;
             case SDL_KEYUP:
                 code = evt.key.keysym.scancode;
-                List_remove(input->keysDown, (void *) code);
+                if ((unsigned) code < SDL_NUM_SCANCODES) {
+                    KeySet_clear(input->keysDown, code);
+                    KeySet_set(input->keysReleased, code);
+                }
                 if (code == SDL_SCANCODE_LSHIFT || code == SDL_SCANCODE_RSHIFT) {
                     input->shift = false;
                 } else if (code == SDL_SCANCODE_LCTRL || code == SDL_SCANCODE_RCTRL) {
@@ -162,10 +175,8 @@ void Input_update(Input *input) {
                 }
                 break;
             case SDL_MOUSEMOTION:
-                if (input->mousePos) {
-                    Position_destroy(input->mousePos);
-                }
-                input->mousePos = Position_new(evt.motion.x, evt.motion.y);
+                input->mouse_x = evt.motion.x;
+                input->mouse_y = evt.motion.y;
                 break;
             default:
                 break;
@@ -174,20 +185,23 @@ void Input_update(Input *input) {
 }
 
 bool Input_keyDown(Input *input, SDL_Scancode key) {
-    return List_contains(input->keysDown, (void *) key, false);
+    return KeySet_test(input->keysDown, key);
+}
+
+bool Input_keyPressed(Input *input, SDL_Scancode key) {
+    return KeySet_test(input->keysPressed, key);
+}
+
+bool Input_keyReleased(Input *input, SDL_Scancode key) {
+    return KeySet_test(input->keysReleased, key);
 }
 
 bool Input_mouseInRect(Input *input, SDL_FRect rect) {
     if (!input) return false;
-    Position *mouse = input->mousePos;
-    if (!mouse) {
-        log_message(LOG_LEVEL_WARN, "Mouse don't have a position set");
-        return false;
-    }
-    return mouse->x >= rect.x &&
-           mouse->x < rect.x + rect.w &&
-           mouse->y >= rect.y &&
-           mouse->y < rect.y + rect.h;
+    return input->mouse_x >= rect.x &&
+           input->mouse_x < rect.x + rect.w &&
+           input->mouse_y >= rect.y &&
+           input->mouse_y < rect.y + rect.h;
 }
 
 void Input_addKeyEventHandler(Input *input, SDL_Scancode key, EventHandlerFunc func, void *data) {
@@ -199,14 +213,12 @@ void Input_addKeyEventHandler(Input *input, SDL_Scancode key, EventHandlerFunc f
     }
     handler->func = func;
     handler->data = data;
-    if (!Map_containsKey(input->keyEventHandlers, (void *) key)) {
-        List *handlers = List_create();
-        List_push(handlers, (void *) handler);
-        Map_put(input->keyEventHandlers, (void *) key, handlers);
-    } else {
-        List *handlers = Map_get(input->keyEventHandlers, (void *) key);
-        List_push(handlers, (void *) handler);
+    List *handlers = Map_get(input->keyEventHandlers, (void *) (unsigned long) key);
+    if (!handlers) {
+        handlers = List_create();
+        Map_put(input->keyEventHandlers, (void *) (unsigned long) key, handlers);
     }
+    List_push(handlers, (void *) handler);
 }
 
 static void Input_destroyEventHandler(void* value) {
@@ -216,18 +228,18 @@ static void Input_destroyEventHandler(void* value) {
 
 void Input_removeKeyEventHandler(Input *input, SDL_Scancode key) {
     if (!input) return;
-    List_destroyWitValues(Map_get(input->keyEventHandlers, (void*)key), Input_destroyEventHandler);
-    Map_remove(input->keyEventHandlers, (void *) key);
+    List_destroyWitValues(Map_get(input->keyEventHandlers, (void *) (unsigned long) key), Input_destroyEventHandler);
+    Map_remove(input->keyEventHandlers, (void *) (unsigned long) key);
 }
 
 void Input_removeOneKeyEventHandler(Input *input, SDL_Scancode key, void *data) {
     if (!input || !data) return;
 
-    if (!Map_containsKey(input->keyEventHandlers, (void *) key)) {
+    List *handlers = Map_get(input->keyEventHandlers, (void *) (unsigned long) key);
+    if (!handlers) {
         return;
     }
 
-    List *handlers = Map_get(input->keyEventHandlers, (void *) key);
     ListIterator *it = ListIterator_new(handlers);
     while (ListIterator_hasNext(it)) {
         EventHandler *handler = ListIterator_next(it);
@@ -239,7 +251,7 @@ void Input_removeOneKeyEventHandler(Input *input, SDL_Scancode key, void *data)
     }
     ListIterator_destroy(it);
     if (List_size(handlers) == 0) {
-        Map_remove(input->keyEventHandlers, (void *) key);
+        Map_remove(input->keyEventHandlers, (void *) (unsigned long) key);
         List_destroy(handlers);
     }
 }
@@ -258,14 +270,12 @@ void Input_addEventHandler(Input *input, Uint32 eventType, EventHandlerFunc func
     }
     handler->func = func;
     handler->data = data;
-    if (!Map_containsKey(input->eventHandlers, (void *) (unsigned long) eventType)) {
-        List *handlers = List_create();
-        List_push(handlers, (void *) handler);
+    List *handlers = Map_get(input->eventHandlers, (void *) (unsigned long) eventType);
+    if (!handlers) {
+        handlers = List_create();
         Map_put(input->eventHandlers, (void *) (unsigned long) eventType, handlers);
-    } else {
-        List *handlers = Map_get(input->eventHandlers, (void *) (unsigned long) eventType);
-        List_push(handlers, (void *) handler);
     }
+    List_push(handlers, (void *) handler);
 }
 
 void Input_removeEventHandler(Input *input, Uint32 eventType) {
@@ -277,11 +287,11 @@ void Input_removeEventHandler(Input *input, Uint32 eventType) {
 void Input_removeOneEventHandler(Input *input, Uint32 eventType, void *data) {
     if (!input || !data) return;
 
-    if (!Map_containsKey(input->eventHandlers, (void *) (unsigned long) eventType)) {
+    List *handlers = Map_get(input->eventHandlers, (void *) (unsigned long) eventType);
+    if (!handlers) {
         return;
     }
 
-    List *handlers = Map_get(input->eventHandlers, (void *) (unsigned long) eventType);
     ListIterator *it = ListIterator_new(handlers);
     while (ListIterator_hasNext(it)) {
         EventHandler *handler = ListIterator_next(it);
@@ -306,7 +316,6 @@ void Input_clearEventHandlers(Input *input) {
 
 void Input_getMousePosition(Input* input, float* x, float* y) {
     if (!input) return;
-    if (!input->mousePos) return;
-    if (x) *x = input->mousePos->x;
-    if (y) *y = input->mousePos->y;
+    if (x) *x = input->mouse_x;
+    if (y) *y = input->mouse_y;
 }
\ No newline at end of file
@@ -5,6 +5,7 @@
 #include "input_box.h"
 
 #include "app.h"
+#include "arena.h"
 #include "input.h"
 #include "logger.h"
 #include "style.h"
@@ -80,7 +81,7 @@ void InputBox_render(InputBox *self, SDL_Renderer *renderer) {
         //Text_setStringf(self->text, "%s|", InputBox_getFormattedString(self));
         char* formattedStr = InputBox_getFormattedString(self);
         size_t len = strlen(formattedStr);
-        char* displayStr = calloc(len + 2, sizeof(char));
+        char* displayStr = Arena_alloc(self->app->frame_arena, len + 2);
         if (!displayStr) {
             error("Failed to allocate memory for InputBox display string");
             return;
@@ -90,7 +91,6 @@ void InputBox_render(InputBox *self, SDL_Renderer *renderer) {
         memcpy(displayStr + self->cursor_index + 1, formattedStr + self->cursor_index, len - self->cursor_index);
         displayStr[len + 1] = '\0';
         Text_setString(self->text, displayStr);
-        safe_free((void**)&displayStr);
     } else {
         Text_setString(self->text, InputBox_getFormattedString(self));
     }
@@ -134,6 +134,7 @@ void InputBox_unFocus(InputBox *self) {
 }
 
 void InputBox_setString(InputBox *self, const char *str) {
+    safe_free((void**)&self->str);
     self->str = Strdup(str);
     self->cursor_index = fmaxf(0, strlen(self->str));
     Text_setString(self->text, str);
@@ -143,7 +144,8 @@ char* InputBox_getFormattedString(InputBox* self) {
     if (!self) return NULL;
     if (self->password_mode) {
         size_t len = strlen(self->str);
-        char* maskedStr = calloc(len + 1, sizeof(char));
+        char* maskedStr = Arena_alloc(self->app->frame_arena, len + 1);
+        if (!maskedStr) return self->str;
         for (size_t i = 0; i < len; i++) {
             maskedStr[i] = '*';
         }
@@ -161,6 +163,7 @@ void InputBox_setStringf(InputBox *self, const char *format, ...) {
     char buffer[1024];
     vsnprintf(buffer, sizeof(buffer), format, args);
     va_end(args);
+    safe_free((void**)&self->str);
     self->str = Strdup(buffer);
     self->cursor_index = fmaxf(0, strlen(self->str));
     Text_setString(self->text, buffer);
@@ -8,11 +8,11 @@
 #include "element.h"
 #include "geometry.h"
 #include "input_box.h"
-#include "list.h"
 #include "logger.h"
 #include "style.h"
 #include "text.h"
 #include "utils.h"
+#include "vector.h"
 
 static void FlexItem_getElementSize(FlexItem *item, float *width, float *height) {
     Element *element = item->element;
@@ -188,7 +188,7 @@ FlexContainer *FlexContainer_new(const float x, const float y, const float width
         return NULL;
     }
 
-    container->items = List_create();
+    container->items = Vector_create();
     if (!container->items) {
         error("FlexContainer_new: Failed to create items list");
         safe_free((void **) &container);
@@ -211,13 +211,11 @@ void FlexContainer_destroy(FlexContainer *container) {
     if (!container) return;
 
     if (container->items) {
-        ListIterator *it = ListIterator_new(container->items);
-        while (ListIterator_hasNext(it)) {
-            FlexItem *item = ListIterator_next(it);
+        for (size_t i = 0; i < Vector_size(container->items); i++) {
+            FlexItem *item = Vector_get(container->items, i);
             safe_free((void **) &item);
         }
-        ListIterator_destroy(it);
-        List_destroy(container->items);
+        Vector_destroy(container->items);
     }
 
     safe_free((void **) &container);
@@ -267,13 +265,13 @@ void FlexContainer_addElement(FlexContainer *container, Element *element, float
         }
     }
 
-    List_push(container->items, item);
+    Vector_push(container->items, item);
 }
 
 void FlexContainer_layout(FlexContainer *container) {
     if (!container || !container->items) return;
 
-    int item_count = List_size(container->items);
+    int item_count = Vector_size(container->items);
     if (item_count == 0) return;
 
     bool is_row = container->direction == FLEX_DIRECTION_ROW || container->direction == FLEX_DIRECTION_ROW_REVERSE;
@@ -285,9 +283,8 @@ void FlexContainer_layout(FlexContainer *container) {
     float total_flex_shrink = 0;
     float total_gap = container->gap * (item_count - 1);
 
-    ListIterator *it = ListIterator_new(container->items);
-    while (ListIterator_hasNext(it)) {
-        FlexItem *item = ListIterator_next(it);
+    for (size_t i = 0; i < Vector_size(container->items); i++) {
+        FlexItem *item = Vector_get(container->items, i);
         if (!item) continue;
         total_main_size += is_row ? item->width : item->height;
         if (item->element->type == ELEMENT_TYPE_BUTTON) {
@@ -299,14 +296,12 @@ void FlexContainer_layout(FlexContainer *container) {
         total_flex_grow += item->flex_grow;
         total_flex_shrink += item->flex_shrink;
     }
-    ListIterator_destroy(it);
 
     float available_space = (is_row ? container->width : container->height) - total_main_size - total_gap;
 
     if (available_space > 0 && total_flex_grow > 0) {
-        it = ListIterator_new(container->items);
-        while (ListIterator_hasNext(it)) {
-            FlexItem *item = ListIterator_next(it);
+        for (size_t i = 0; i < Vector_size(container->items); i++) {
+            FlexItem *item = Vector_get(container->items, i);
             if (item->flex_grow > 0) {
                 float extra = (available_space * item->flex_grow) / total_flex_grow;
                 if (is_row) {
@@ -317,13 +312,11 @@ void FlexContainer_layout(FlexContainer *container) {
                 //log_message(LOG_LEVEL_DEBUG, "Width : %f Height : %f", item->width, item->height);
             }
         }
-        ListIterator_destroy(it);
         available_space = 0;
     } else if (available_space < 0 && total_flex_shrink > 0) {
         float shrink_amount = -available_space;
-        it = ListIterator_new(container->items);
-        while (ListIterator_hasNext(it)) {
-            FlexItem *item = ListIterator_next(it);
+        for (size_t i = 0; i < Vector_size(container->items); i++) {
+            FlexItem *item = Vector_get(container->items, i);
             if (item->flex_shrink > 0) {
                 float reduction = (shrink_amount * item->flex_shrink) / total_flex_shrink;
                 if (is_row) {
@@ -333,7 +326,6 @@ void FlexContainer_layout(FlexContainer *container) {
                 }
             }
         }
-        ListIterator_destroy(it);
         available_space = 0;
     }
 
@@ -367,9 +359,8 @@ void FlexContainer_layout(FlexContainer *container) {
 
     float current_main = main_start;
 
-    it = ListIterator_new(container->items);
-    while (ListIterator_hasNext(it)) {
-        FlexItem *item = ListIterator_next(it);
+    for (size_t i = 0; i < Vector_size(container->items); i++) {
+        FlexItem *item = Vector_get(container->items, i);
         float eltX, eltY;
         FlexItem_getElementPosition(item, &eltX, &eltY);
 
@@ -437,19 +428,16 @@ void FlexContainer_layout(FlexContainer *container) {
         }
         current_main += main_size + container->gap + item_spacing;
     }
-    ListIterator_destroy(it);
 }
 
 void FlexContainer_clear(FlexContainer* container) {
     if (!container) return;
 
-    ListIterator* it = ListIterator_new(container->items);
-    while (ListIterator_hasNext(it)) {
-        FlexItem* item = ListIterator_next(it);
+    for (size_t i = 0; i < Vector_size(container->items); i++) {
+        FlexItem* item = Vector_get(container->items, i);
         safe_free((void**)&item);
     }
-    ListIterator_destroy(it);
-    List_clear(container->items);
+    Vector_clear(container->items);
 }
 
 void FlexContainer_setSize(FlexContainer* container, float width, float height) {
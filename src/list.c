@@ -4,6 +4,7 @@
  */
 #include "list.h"
 #include "logger.h"
+#include "pool.h"
 #include "utils.h"
 #include "string_builder.h"
 #include "column_graph.h"
@@ -22,6 +23,12 @@ List *List_create() {
         safe_free((void **) &list);
         return NULL;
     }
+    list->nodes = Pool_create(sizeof(ListNode), LIST_NODES_PER_CHUNK);
+    if (!list->nodes) {
+        safe_free((void **) &list->head);
+        safe_free((void **) &list);
+        return NULL;
+    }
     list->head->prev = list->head;
     list->head->next = list->head;
     list->size = 0;
@@ -30,7 +37,7 @@ List *List_create() {
 
 void List_destroy(List *list) {
     if (!list) return;
-    List_clear(list);
+    Pool_destroy(list->nodes);
     safe_free((void **) &list->head);
     safe_free((void **) &list);
 }
@@ -47,20 +54,15 @@ void List_destroyWitValues(List* list, DestroyFunc destroy_func) {
 }
 
 void List_clear(List *list) {
-    ListNode *node = list->head->next;
-    while (node != list->head) {
-        ListNode *next = node->next;
-        if (node == list->head && next == list->head) break;
-        safe_free((void **) &node);
-        node = next;
-    }
+    // All nodes live in the list's slab: hand them back at once instead of walking the list.
+    Pool_clear(list->nodes);
     list->size = 0;
     list->head->prev = list->head;
     list->head->next = list->head;
 }
 
 void List_push(List *list, void *value) {
-    ListNode *node = calloc(1, sizeof(ListNode));
+    ListNode *node = Pool_alloc(list->nodes);
     if (!node) {
         error("Failed to allocate memory for ListNode");
         return;
@@ -82,7 +84,7 @@ void List_remove(List *list, void *value) {
             ListNode *next = node->next;
             prev->next = next;
             next->prev = prev;
-            safe_free((void **) &node);
+            Pool_free(list->nodes, node);
             list->size--;
             return;
         }
@@ -104,7 +106,7 @@ void *List_pop(List *list, size_t index) {
     ListNode *next = node->next;
     prev->next = next;
     next->prev = prev;
-    safe_free((void **) &node);
+    Pool_free(list->nodes, node);
     list->size--;
     return value;
 }
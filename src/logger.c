@@ -5,33 +5,34 @@
 #include "logger.h"
 #include "ansi.h"
 
-#ifndef WIN32
-static pthread_mutex_t mutex = PTHREAD_MUTEX_INITIALIZER;
-#endif
+// Bounded multi-producer queue (one sequence number per slot), drained by the flusher thread only.
+static LogRecord log_queue[LOG_QUEUE_SIZE];
+static SDL_atomic_t log_enqueue_pos;
+static int log_dequeue_pos;
+static SDL_atomic_t log_dropped;
+static SDL_atomic_t log_running;
+static SDL_sem* log_signal;
+static SDL_Thread* log_thread;
+
+static void Logger_print(LogLevel level, time_t time, const char* message);
+static bool Logger_drain();
+static int Logger_run(void* data);
 
-char* get_level_color(const LogLevel level) {
-    char* buffer = malloc(16);
+const char* get_level_color(const LogLevel level) {
     switch (level) {
         case LOG_LEVEL_DEBUG:
-            sprintf(buffer, "%s", ANSI_COLOR_CYAN);
-            break;
+            return ANSI_COLOR_CYAN;
         case LOG_LEVEL_INFO:
-            sprintf(buffer, "%s", ANSI_COLOR_GREEN);
-            break;
+            return ANSI_COLOR_GREEN;
         case LOG_LEVEL_WARN:
-            sprintf(buffer, "%s", ANSI_COLOR_YELLOW);
-            break;
+            return ANSI_COLOR_YELLOW;
         case LOG_LEVEL_ERROR:
-            sprintf(buffer, "%s", ANSI_COLOR_RED);
-            break;
+            return ANSI_COLOR_RED;
         case LOG_LEVEL_FATAL:
-            sprintf(buffer, "%s", ANSI_COLOR_MAGENTA);
-            break;
+            return ANSI_COLOR_MAGENTA;
         default:
-            sprintf(buffer, "%s", ANSI_COLOR_RESET);
-            break;
+            return ANSI_COLOR_RESET;
     }
-    return buffer;
 }
 
 const char* get_level_string(const LogLevel level) {
@@ -51,39 +52,123 @@ const char* get_level_string(const LogLevel level) {
     }
 }
 
-void log_message(const LogLevel level, const char* format, ...) {
-#ifndef WIN32
-    pthread_mutex_lock(&mutex);
-    if (level == LOG_LEVEL_DEBUG) {
-#if !defined(PRODUCTION) || (defined(PRODUCTION) && PRODUCTION == 1)
-        pthread_mutex_unlock(&mutex);
-        return;
-#endif
-    }
+// Only ever called by one thread at a time: the flusher, or the caller when no flusher runs.
+static void Logger_print(LogLevel level, time_t time, const char* message) {
+    // Messages come in bursts within the same second, format the date once per second.
+    static time_t cached_time = -1;
+    static char datetime[32];
+    if (time != cached_time) {
+        struct tm t;
+#ifdef WIN32
+        localtime_s(&t, &time);
 #else
-    if (level == LOG_LEVEL_DEBUG) {
-        return;
-    }
+        localtime_r(&time, &t);
 #endif
-    time_t now = time(NULL);
-    struct tm* t = localtime(&now);
-    char datetime[32];
-    strftime(datetime, sizeof(datetime)-1, "%Y-%m-%d %H:%M:%S", t);
-
-    const char* levelStr = get_level_string(level);
-    char* levelColor = get_level_color(level);
+        strftime(datetime, sizeof(datetime), "%Y-%m-%d %H:%M:%S", &t);
+        cached_time = time;
+    }
+    printf("%s%s %s %s%s\n", get_level_color(level), datetime, get_level_string(level), message, ANSI_COLOR_RESET);
+}
 
-    char msg[1024];
+void log_write(const LogLevel level, const char* format, ...) {
     va_list args;
     va_start(args, format);
-    vsnprintf(msg, sizeof(msg), format, args);
+    if (!SDL_AtomicGet(&log_running)) {
+        char message[LOG_MESSAGE_SIZE];
+        vsnprintf(message, sizeof(message), format, args);
+        va_end(args);
+        Logger_print(level, time(NULL), message);
+        return;
+    }
+
+    LogRecord* record;
+    int pos = SDL_AtomicGet(&log_enqueue_pos);
+    while (true) {
+        record = &log_queue[(unsigned int) pos & (LOG_QUEUE_SIZE - 1)];
+        int diff = SDL_AtomicGet(&record->sequence) - pos;
+        if (diff == 0) {
+            if (SDL_AtomicCAS(&log_enqueue_pos, pos, (int) ((unsigned int) pos + 1))) break;
+        } else if (diff < 0) {
+            // Queue full: drop rather than make a sort thread or a frame wait for the terminal.
+            va_end(args);
+            SDL_AtomicAdd(&log_dropped, 1);
+            return;
+        }
+        pos = SDL_AtomicGet(&log_enqueue_pos);
+    }
+    record->level = level;
+    record->time = time(NULL);
+    vsnprintf(record->message, sizeof(record->message), format, args);
     va_end(args);
+    SDL_AtomicSet(&record->sequence, (int) ((unsigned int) pos + 1));
+    SDL_SemPost(log_signal);
+}
 
-    printf("%s%s %s %s%s\n", levelColor, datetime, levelStr, msg, ANSI_COLOR_RESET);
-    free(levelColor);
-#ifndef WIN32
-    pthread_mutex_unlock(&mutex);
-#endif
+static bool Logger_drain() {
+    bool printed = false;
+    while (true) {
+        LogRecord* record = &log_queue[(unsigned int) log_dequeue_pos & (LOG_QUEUE_SIZE - 1)];
+        if (SDL_AtomicGet(&record->sequence) != (int) ((unsigned int) log_dequeue_pos + 1)) break;
+        Logger_print(record->level, record->time, record->message);
+        SDL_AtomicSet(&record->sequence, (int) ((unsigned int) log_dequeue_pos + LOG_QUEUE_SIZE));
+        log_dequeue_pos = (int) ((unsigned int) log_dequeue_pos + 1);
+        printed = true;
+    }
+    int dropped = SDL_AtomicSet(&log_dropped, 0);
+    if (dropped > 0) {
+        char message[64];
+        snprintf(message, sizeof(message), "%d log messages dropped, queue full", dropped);
+        Logger_print(LOG_LEVEL_WARN, time(NULL), message);
+        printed = true;
+    }
+    if (printed) {
+        fflush(stdout);
+    }
+    return printed;
+}
+
+static int Logger_run(void* data) {
+    (void) data;
+    while (SDL_AtomicGet(&log_running)) {
+        SDL_SemWaitTimeout(log_signal, 100);
+        Logger_drain();
+    }
+    Logger_drain();
+    return 0;
+}
+
+void Logger_start() {
+    if (log_thread) return;
+    for (int i = 0; i < LOG_QUEUE_SIZE; i++) {
+        SDL_AtomicSet(&log_queue[i].sequence, i);
+    }
+    SDL_AtomicSet(&log_enqueue_pos, 0);
+    log_dequeue_pos = 0;
+    log_signal = SDL_CreateSemaphore(0);
+    if (!log_signal) {
+        log_message(LOG_LEVEL_WARN, "Cannot create logger semaphore, logging stays synchronous: %s", SDL_GetError());
+        return;
+    }
+    SDL_AtomicSet(&log_running, 1);
+    log_thread = SDL_CreateThread(Logger_run, "Logger", NULL);
+    if (!log_thread) {
+        SDL_AtomicSet(&log_running, 0);
+        SDL_DestroySemaphore(log_signal);
+        log_signal = NULL;
+        log_message(LOG_LEVEL_WARN, "Cannot create logger thread, logging stays synchronous: %s", SDL_GetError());
+    }
+}
+
+void Logger_stop() {
+    if (!log_thread) return;
+    SDL_AtomicSet(&log_running, 0);
+    SDL_SemPost(log_signal);
+    SDL_WaitThread(log_thread, NULL);
+    log_thread = NULL;
+    // A message enqueued while the flusher was exiting is still printed here.
+    Logger_drain();
+    SDL_DestroySemaphore(log_signal);
+    log_signal = NULL;
 }
 
 void log_error(const char* file, const int line, const char* func, const char* error, ...) {
@@ -93,10 +178,7 @@ void log_error(const char* file, const int line, const char* func, const char* e
     vsnprintf(buffer, sizeof(buffer), error, args);
     va_end(args);
 
-    char final_msg[1096];
-    snprintf(final_msg, sizeof(final_msg), "function %s, file %s, line %d\n%s", func, file, line, buffer);
-
-    log_message(LOG_LEVEL_ERROR, "%s", final_msg);
+    log_message(LOG_LEVEL_ERROR, "function %s, file %s, line %d\n%s", func, file, line, buffer);
 }
 
 void test_all_log() {
@@ -105,4 +187,4 @@ void test_all_log() {
     log_message(LOG_LEVEL_WARN, "This is a warning message.");
     log_message(LOG_LEVEL_ERROR, "This is an error message.");
     log_message(LOG_LEVEL_FATAL, "This is a fatal message.");
-}
\ No newline at end of file
+}
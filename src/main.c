@@ -4,15 +4,31 @@
  */
 #include "Settings.h"
 #include "app.h"
+#include "arena.h"
+#include "audio.h"
 #include "frame.h"
 #include "logger.h"
 #include "utils.h"
 #include "input.h"
 #include "list.h"
 #include "main_frame.h"
+#include "profiler.h"
 #include "random.h"
 #include "resource_manager.h"
 #include "style.h"
+#include "trace.h"
+
+static void toggleTrace() {
+    if (!Trace_isRecording()) {
+        Trace_start();
+        Trace_setThreadName("Main");
+        return;
+    }
+    Trace_stop();
+    char path[64];
+    snprintf(path, sizeof(path), "trace-%ld.json", (long) time(NULL));
+    Trace_dump(path);
+}
 
 #if 1
 int main() {
@@ -25,6 +41,7 @@ int main() {
     if (exitStatus == EXIT_FAILURE) {
         exit(exitStatus);
     };
+    Logger_start();
 
     SDL_WindowFlags flags = SDL_WINDOW_RESIZABLE;
 
@@ -48,11 +65,12 @@ int main() {
         exit(EXIT_FAILURE);
     }
 
-    if (Mix_OpenAudio(44100, AUDIO_S16SYS, 1, 4096) < 0) {
+    if (Mix_OpenAudio(AUDIO_SAMPLE_RATE, AUDIO_S16SYS, 1, 4096) < 0) {
         error("Unable to initialize SDL_mixer: %s", Mix_GetError());
         SDL_Quit();
         exit(EXIT_FAILURE);
     }
+    Audio_startSonification();
 
     log_message(LOG_LEVEL_INFO, "Successfully initialized SDL, Window and Renderer. Start looping app...");
     App* app = App_create(window, renderer);
@@ -70,12 +88,20 @@ int main() {
     while (app->running) {
         Uint64 frame_start = SDL_GetTicks();
 
-        Input_update(app->input);
+        PROFILER_SCOPE(app->profiler, PROFILER_PHASE_INPUT) TRACE_SCOPE("Input") {
+            Input_update(app->input);
+        }
 
         if (app->input->quit) {
             app->running = false;
             break;
         }
+        if (Input_keyPressed(app->input, SDL_SCANCODE_F3)) {
+            Profiler_toggle(app->profiler);
+        }
+        if (Input_keyPressed(app->input, SDL_SCANCODE_F4)) {
+            toggleTrace();
+        }
 
         SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
 
@@ -90,7 +116,9 @@ int main() {
             continue;
         }
 
-        Frame_update(frame);
+        PROFILER_SCOPE(app->profiler, PROFILER_PHASE_UPDATE) TRACE_SCOPE("Update") {
+            Frame_update(frame);
+        }
         if (app->frameChanged) {
             frame = App_getCurrentFrame(app);
             app->frameChanged = false;
@@ -99,26 +127,47 @@ int main() {
                 continue;
             }
         }
-        Frame_render(frame, renderer);
+        PROFILER_SCOPE(app->profiler, PROFILER_PHASE_RENDER) TRACE_SCOPE("Render") {
+            Frame_render(frame, renderer);
+        }
+        Profiler_render(app->profiler, app);
+
+        PROFILER_SCOPE(app->profiler, PROFILER_PHASE_PRESENT) TRACE_SCOPE("Present") {
+            SDL_RenderPresent(app->renderer);
+        }
 
-        SDL_RenderPresent(app->renderer);
+        // Everything allocated for this frame is gone, transient pointers must not outlive it.
+        Arena_reset(app->frame_arena);
+        Profiler_endFrame(app->profiler);
 
         Uint64 frame_time = SDL_GetTicks() - frame_start;
         if (frame_delay > frame_time) {
-            SDL_Delay(frame_delay - frame_time);
+            TRACE_SCOPE("Frame pacing") {
+                SDL_Delay(frame_delay - frame_time);
+            }
         }
     }
 
+    if (Trace_isRecording()) {
+        toggleTrace();
+    }
+
     while (List_size(app->stack) > 0) {
         Frame* frame = List_popLast(app->stack);
         Frame_destroy(frame);
     }
 
+    Audio_stopSonification();
+
     // Need to be destroyed before App_quit because it uses SDL3 functions
+    Profiler_destroy(app->profiler);
+    app->profiler = NULL;
     ResourceManager_destroy(app->manager);
 
+    Logger_stop();
     App_quit(app);
     App_destroy(app);
+    Trace_shutdown();
     log_message(LOG_LEVEL_INFO, "App has been closed.");
     return EXIT_SUCCESS;
 }
@@ -5,6 +5,7 @@
 #include "main_frame.h"
 
 #include "app.h"
+#include "audio.h"
 #include "button.h"
 #include "checkbox.h"
 #include "column_graph.h"
@@ -14,23 +15,36 @@
 #include "input.h"
 #include "layout.h"
 #include "logger.h"
+#include "map.h"
 #include "list.h"
+#include "oscillator.h"
 #include "utils.h"
+#include "vector.h"
 #include "color.h"
 #include "container.h"
 #include "help_frame.h"
 #include "image.h"
 #include "input_box.h"
+#include "profiler.h"
 #include "random.h"
 #include "resource_manager.h"
 #include "select.h"
 #include "sort.h"
+#include "stats.h"
 #include "style.h"
 #include "text.h"
 #include "timer.h"
 #include "tinyfiledialogs.h"
-
-static void MainFrame_addElements(MainFrame* self, App* app);
+#include "trace.h"
+
+static void MainFrame_buildSettings(MainFrame* self);
+static void MainFrame_addDelayInput(MainFrame* self, Container* container);
+static void MainFrame_removeDelayInput(Container* container);
+static void MainFrame_refreshSettings(MainFrame* self);
+static bool MainFrame_isEditingSettings(Container* container);
+static void MainFrame_showElement(MainFrame* self, Element* element);
+static void MainFrame_removeElement(MainFrame* self, const char* id);
+static void MainFrame_renderSelectionOverlay(MainFrame* self, SDL_Renderer* renderer);
 static void MainFrame_onEscape(Input* input, SDL_Event* evt, MainFrame* self);
 static void MainFrame_onRuneS(Input* input, SDL_Event* evt, MainFrame* self);
 static void MainFrame_onRuneP(Input* input, SDL_Event* evt, MainFrame* self);
@@ -38,6 +52,7 @@ static void MainFrame_onRuneM(Input* input, SDL_Event* evt, MainFrame* self);
 static void MainFrame_DelaySort(MainFrame* self, ColumnGraph* graph, ColumnGraphBar* actual, ColumnGraphBar* second);
 static void MainFrame_onEnter(Input* input, SDL_Event* evt, MainFrame* self);
 static void MainFrame_onClick(Input* input, SDL_Event* evt, MainFrame* self);
+static void MainFrame_onSettingsPointer(Input* input, SDL_Event* evt, MainFrame* self);
 static bool MainFrame_createPopup(MainFrame* self, void* value, ColumnGraphType type);
 static bool MainFrame_removePopup(MainFrame* self, void* value, ColumnGraphType type);
 static void MainFrame_quitApp(Input* input, SDL_Event* evt, Button* button);
@@ -45,6 +60,8 @@ static void MainFrame_loadFile(Input* input, SDL_Event* evt, Button* button);
 static void MainFrame_onSpace(Input* input, SDL_Event* evt, MainFrame* self);
 static void MainFrame_onRuneA(Input* input, SDL_Event* evt, MainFrame* self);
 static void MainFrame_onGraphThemeChange(Input* input, SDL_Event* evt, Select* select);
+static ColumnGraph* MainFrame_getGraphAt(MainFrame* self, float x, float y);
+static void MainFrame_updateGraphHover(MainFrame* self, float x, float y);
 static void MainFrame_onMouseMove(Input* input, SDL_Event* evt, MainFrame* self);
 static void MainFrame_updateHelpImage(MainFrame* self);
 static void MainFrame_onWindowResize(Input* input, SDL_Event* evt, MainFrame* self);
@@ -52,6 +69,8 @@ static void MainFrame_onRuneI(Input* input, SDL_Event* evt, MainFrame* self);
 static void MainFrame_showGraphInfo(MainFrame* self, int index, ColumnGraph* graph);
 static void MainFrame_hideGraphInfo(MainFrame* self);
 static void MainFrame_onRuneO(Input* input, SDL_Event* evt, MainFrame* self);
+static void MainFrame_onShiftO(Input* input, SDL_Event* evt, MainFrame* self);
+static void MainFrame_onShiftI(Input* input, SDL_Event* evt, MainFrame* self);
 static bool MainFrame_isGraphSorting(MainFrame* self);
 static void MainFrame_onRuneB(Input* input, SDL_Event* evt, MainFrame* self);
 static void MainFrame_showTempText(MainFrame* self, const char* text);
@@ -64,6 +83,8 @@ static void MainFrame_onShiftS(Input* input, SDL_Event* evt, MainFrame* self);
 static void MainFrame_onTabulation(Input* input, SDL_Event* evt, MainFrame* self);
 static void MainFrame_onShiftSpace(Input* input, SDL_Event* evt, MainFrame* self);
 static void MainFrame_onRuneH(Input* input, SDL_Event* evt, MainFrame* self);
+static void MainFrame_onRuneN(Input* input, SDL_Event* evt, MainFrame* self);
+static void MainFrame_playBarTone(ColumnGraph* graph, ColumnGraphBar* bar);
 
 MainFrame* MainFrame_new(App* app) {
     MainFrame* self = calloc(1, sizeof(MainFrame));
@@ -73,9 +94,12 @@ MainFrame* MainFrame_new(App* app) {
     }
 
     self->app = app;
-    self->elements = List_create();
-    if (!self->elements) {
+    self->elements = Vector_create();
+    self->elements_by_id = Map_create(true);
+    if (!self->elements || !self->elements_by_id) {
         error("Failed to create elements list for MainFrame");
+        Vector_destroy(self->elements);
+        Map_destroy(self->elements_by_id);
         safe_free((void **) &self);
         return NULL;
     }
@@ -111,20 +135,14 @@ MainFrame* MainFrame_new(App* app) {
     self->last_width = w;
     self->last_height = h;
     self->popup = NULL;
-    MainFrame_addElements(self, app);
+    MainFrame_buildSettings(self);
     return self;
 }
 
-static void MainFrame_addElements(MainFrame* self, App* app) {
-    ListIterator* it = ListIterator_new(self->elements);
-    while (ListIterator_hasNext(it)) {
-        Element* element = ListIterator_next(it);
-        if (String_equals(element->id, "settings")) {
-            Element_destroy(element);
-        }
-    }
-    ListIterator_destroy(it);
-    List_clear(self->elements);
+// The settings panel is retained: built once here and only rebuilt when the window size changes.
+// Value changes go through MainFrame_refreshSettings, which updates the widgets in place.
+static void MainFrame_buildSettings(MainFrame* self) {
+    App* app = self->app;
     int w, h;
     SDL_GetWindowSize(app->window, &w, &h);
 
@@ -136,6 +154,7 @@ static void MainFrame_addElements(MainFrame* self, App* app) {
     int y = 10;
 
     Container* container = Container_new(baseWidth, 0, self->settings_width, h, false, Color_rgba(0, 0, 0, 200), self);
+    Container_setCacheLayer(container, true);
     Text* titleText = Text_new(app->renderer,
                                TextStyle_new(
                                    ResourceManager_getDefaultBoldFont(app->manager, 36),
@@ -197,7 +216,7 @@ static void MainFrame_addElements(MainFrame* self, App* app) {
     Select_setPosition(select, baseWidth + ((self->settings_width - selectWidth) / 2), y);
     Select_setSelectedIndex(select, self->graph_style);
     Select_onChange(select, (EventHandlerFunc) MainFrame_onGraphThemeChange);
-    Container_addChild(container, Element_fromSelect(select, NULL));
+    Container_addChild(container, Element_fromSelect(select, "graphStyle"));
 
     y += select->rect.h + 40;
 
@@ -206,30 +225,15 @@ static void MainFrame_addElements(MainFrame* self, App* app) {
                                    ResourceManager_getDefaultBoldFont(app->manager, 24), 24, COLOR_WHITE,
                                    TTF_STYLE_NORMAL),
                                Position_new(baseWidth + 10, y), false, "Manual delay:");
-    Container_addChild(container, Element_fromText(delay_text, NULL));
+    Container_addChild(container, Element_fromText(delay_text, "delayText"));
 
     Size delaySize = Text_getSize(delay_text);
     Checkbox* delay_checkbox = Checkbox_new(baseWidth + delaySize.width + 10 + 16, y, 32, COLOR_WHITE, COLOR_WHITE, self->automatic_delay, app->input, container);
     Checkbox_onChange(delay_checkbox, (EventHandlerFunc) MainFrame_onCheckboxClicked);
-    Container_addChild(container, Element_fromCheckbox(delay_checkbox, NULL));
-    y += delaySize.height + 30;
+    Container_addChild(container, Element_fromCheckbox(delay_checkbox, "delayCheckbox"));
 
     if (!delay_checkbox->checked) {
-        Text* select_delay_text = Text_new(app->renderer,
-                                   TextStyle_new(
-                                       ResourceManager_getDefaultBoldFont(app->manager, 20), 20, COLOR_WHITE,
-                                       TTF_STYLE_NORMAL),
-                                   Position_new(baseWidth + 10, y), false, "Delay (ms):");
-        Container_addChild(container, Element_fromText(select_delay_text, NULL));
-        Size selectDelaySize = Text_getSize(select_delay_text);
-        y += selectDelaySize.height + 10;
-        InputBox* input_delay = InputBox_new(self->app,
-                                          SDL_CreateRect(baseWidth + 10, y, self->settings_width - 24, inputHeight,
-                                                         false),
-                                          InputBoxStyle_default(self->app->manager),
-                                          container);
-        InputBox_setStringf(input_delay, "%d", self->delay_ms);
-        Container_addChild(container, Element_fromInput(input_delay, "inputDelay"));
+        MainFrame_addDelayInput(self, container);
     }
 
     float buttonXOffset = 20;
@@ -260,31 +264,94 @@ static void MainFrame_addElements(MainFrame* self, App* app) {
 
     Container_addChild(container, Element_fromImage(help_image, "help_image"));
 
-    List_push(self->elements, Element_fromContainer(container, "settings"));
-
-    if (!self->all_selected) {
-        for (int i = 0; i < self->graph_count; i++) {
-            if (i == self->selected_graph_index) continue;
-            ColumnGraph* graph = self->graph[i];
-            Box* box = Box_new(graph->size.width, graph->size.height, 0,
-                               Position_new(graph->position->x, graph->position->y),
-                               Color_rgba(0, 0, 0, 75), NULL, false);
-            List_push(self->elements, Element_fromBox(box, NULL));
-        }
+    Element* element = Element_fromContainer(container, "settings");
+    Element* old = Element_getById(self->elements_by_id, "settings");
+    if (!old) {
+        Element_pushToList(self->elements, self->elements_by_id, element);
+        return;
     }
+    // Take the old panel's slot so it keeps drawing below the dialogs.
+    Map_remove(self->elements_by_id, old->id);
+    Vector_set(self->elements, Vector_indexOf(self->elements, old), element);
+    Map_put(self->elements_by_id, element->id, element);
+    Element_destroy(old);
+}
 
-    if (self->graph_info) {
-        List_push(self->elements, Element_fromContainer(self->graph_info, "graph_info"));
-    }
-    if (self->temp_element) {
-        List_push(self->elements, self->temp_element);
-    }
-    if (self->seed_container) {
-        List_push(self->elements, Element_fromContainer(self->seed_container, "seed_container"));
+static void MainFrame_addDelayInput(MainFrame* self, Container* container) {
+    App* app = self->app;
+    Element* delay_element = Container_getChildById(container, "delayText");
+    float baseWidth = container->box->position->x;
+    float x, y;
+    Element_getPosition(delay_element, &x, &y);
+    y += Text_getSize(delay_element->data.text).height + 30;
+    int inputHeight = 40;
+
+    Text* select_delay_text = Text_new(app->renderer,
+                               TextStyle_new(
+                                   ResourceManager_getDefaultBoldFont(app->manager, 20), 20, COLOR_WHITE,
+                                   TTF_STYLE_NORMAL),
+                               Position_new(baseWidth + 10, y), false, "Delay (ms):");
+    Container_addChild(container, Element_fromText(select_delay_text, "delayLabel"));
+    Size selectDelaySize = Text_getSize(select_delay_text);
+    y += selectDelaySize.height + 10;
+    InputBox* input_delay = InputBox_new(self->app,
+                                      SDL_CreateRect(baseWidth + 10, y, self->settings_width - 24, inputHeight,
+                                                     false),
+                                      InputBoxStyle_default(self->app->manager),
+                                      container);
+    InputBox_setStringf(input_delay, "%d", self->delay_ms);
+    Container_addChild(container, Element_fromInput(input_delay, "inputDelay"));
+}
+
+static void MainFrame_removeDelayInput(Container* container) {
+    const char* ids[] = {"delayLabel", "inputDelay"};
+    for (size_t i = 0; i < sizeof(ids) / sizeof(ids[0]); i++) {
+        Element* child = Container_getChildById(container, ids[i]);
+        if (!child) continue;
+        Container_removeChild(container, child);
+        Element_destroy(child);
     }
-    if (self->sort_type_container) {
-        List_push(self->elements, Element_fromContainer(self->sort_type_container, "sort_type_container"));
+}
+
+static void MainFrame_refreshSettings(MainFrame* self) {
+    Element* settings = Element_getById(self->elements_by_id, "settings");
+    if (!settings) return;
+    Container* container = settings->data.container;
+    InputBox_setStringf(Container_getChildById(container, "inputBar")->data.input_box, "%d", self->bar_count);
+    InputBox_setStringf(Container_getChildById(container, "inputGraph")->data.input_box, "%d", self->graph_count);
+    Select_setSelectedIndex(Container_getChildById(container, "graphStyle")->data.select, self->graph_style);
+    Checkbox_setChecked(Container_getChildById(container, "delayCheckbox")->data.checkbox, self->automatic_delay);
+
+    Element* delay_input = Container_getChildById(container, "inputDelay");
+    if (self->automatic_delay && delay_input) {
+        MainFrame_removeDelayInput(container);
+    } else if (!self->automatic_delay && !delay_input) {
+        MainFrame_addDelayInput(self, container);
+    } else if (delay_input) {
+        InputBox_setStringf(delay_input->data.input_box, "%d", self->delay_ms);
+    }
+    Container_markDirty(container);
+}
+
+static bool MainFrame_isEditingSettings(Container* container) {
+    for (size_t i = 0; i < Vector_size(container->children); i++) {
+        Element* child = Vector_get(container->children, i);
+        if (child->type == ELEMENT_TYPE_INPUT && child->data.input_box->selected) {
+            return true;
+        }
     }
+    return false;
+}
+
+static void MainFrame_showElement(MainFrame* self, Element* element) {
+    Element_pushToList(self->elements, self->elements_by_id, element);
+}
+
+static void MainFrame_removeElement(MainFrame* self, const char* id) {
+    Element* element = Element_getById(self->elements_by_id, id);
+    if (!element) return;
+    Element_removeFromList(self->elements, self->elements_by_id, element);
+    Element_destroy(element);
 }
 
 void MainFrame_destroy(MainFrame* self) {
@@ -302,11 +369,15 @@ void MainFrame_destroy(MainFrame* self) {
     Input_removeOneKeyEventHandler(self->app->input, SDL_SCANCODE_B, self);
     Input_removeOneKeyEventHandler(self->app->input, SDL_SCANCODE_TAB, self);
     Input_removeOneKeyEventHandler(self->app->input, SDL_SCANCODE_H, self);
+    Input_removeOneKeyEventHandler(self->app->input, SDL_SCANCODE_N, self);
 
     Input_removeOneEventHandler(self->app->input, SDL_MOUSEBUTTONDOWN, self);
     Input_removeOneEventHandler(self->app->input, SDL_MOUSEMOTION, self);
     Input_removeOneEventHandler(self->app->input, SDL_WINDOWEVENT, self);
+    Input_removeOneEventHandler(self->app->input, SDL_MOUSEBUTTONUP, self);
+    Input_removeOneEventHandler(self->app->input, SDL_MOUSEWHEEL, self);
 
+    Map_destroy(self->elements_by_id);
     Element_destroyList(self->elements);
 
     if (self->ui_mutex) {
@@ -327,10 +398,13 @@ void MainFrame_destroy(MainFrame* self) {
 void MainFrame_render(SDL_Renderer* renderer, MainFrame* self) {
     for (int i = 0; i < self->graph_count; i++) {
         SDL_mutex* gm = self->graph_mutexes[i];
-        SDL_LockMutex(gm);
+        TRACE_SCOPE("Wait graph mutex") {
+            SDL_LockMutex(gm);
+        }
         ColumnGraph_render(self->graph[i], renderer);
         SDL_UnlockMutex(gm);
     }
+    MainFrame_renderSelectionOverlay(self, renderer);
 
     Element_renderList(self->elements, renderer);
 
@@ -339,21 +413,51 @@ void MainFrame_render(SDL_Renderer* renderer, MainFrame* self) {
     }
 }
 
+static void MainFrame_renderSelectionOverlay(MainFrame* self, SDL_Renderer* renderer) {
+    if (self->all_selected) return;
+    // Dim every graph but the selected one, straight from the selection state.
+    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
+    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 75);
+    for (int i = 0; i < self->graph_count; i++) {
+        if (i == self->selected_graph_index) continue;
+        ColumnGraph* graph = self->graph[i];
+        SDL_FRect rect = {graph->position->x, graph->position->y, graph->size.width, graph->size.height};
+        SDL_RenderFillRectF(renderer, &rect);
+    }
+}
+
 void MainFrame_update(MainFrame* self) {
+    if (self->layout_dirty) {
+        self->layout_dirty = false;
+        self->settings_dirty = false;
+        self->box_animating = false;
+        MainFrame_buildSettings(self);
+    } else if (self->settings_dirty) {
+        self->settings_dirty = false;
+        MainFrame_refreshSettings(self);
+    }
+    if (self->showSettings || self->box_animating) {
+        // The panel is cached as a layer: pointer handlers repaint it, and so does a blinking caret (one last frame to clear it).
+        Container* container = Element_getById(self->elements_by_id, "settings")->data.container;
+        bool editing = MainFrame_isEditingSettings(container);
+        if (editing || self->settings_editing) {
+            Container_markDirty(container);
+        }
+        self->settings_editing = editing;
+    }
     if (self->box_animating) {
         self->box_anim_progress += 0.03f;
         if (self->box_anim_progress >= 1.f) {
             self->box_animating = false;
             self->box_anim_progress = 1.f;
         }
-        Element* settings = Element_getById(self->elements, "settings");
+        Element* settings = Element_getById(self->elements_by_id, "settings");
         Container* container = settings->data.container;
         float xPosBefore = container->box->position->x;
         container->box->position->x = self->box_start_x + (self->box_target_x - self->box_start_x) * self->
                                       box_anim_progress;
-        ListIterator* it = ListIterator_new(container->children);
-        while (ListIterator_hasNext(it)) {
-            Element* child = ListIterator_next(it);
+        for (size_t i = 0; i < Vector_size(container->children); i++) {
+            Element* child = Vector_get(container->children, i);
             float x, y;
             Element_getPosition(child, &x, &y);
             float diff = container->box->position->x - xPosBefore;
@@ -363,10 +467,8 @@ void MainFrame_update(MainFrame* self) {
     }
     if (self->timer && self->timer->started && Timer_getTicks(self->timer) >= 1500) {
         if (self->temp_element) {
-            Element* copy_temp_element = self->temp_element;
+            MainFrame_removeElement(self, "temp_text");
             self->temp_element = NULL;
-            MainFrame_addElements(self, self->app);
-            Element_destroy(copy_temp_element);
         }
         Timer_stop(self->timer);
         return;
@@ -397,10 +499,13 @@ void MainFrame_focus(MainFrame* self) {
     Input_addKeyEventHandler(self->app->input, SDL_SCANCODE_T, (EventHandlerFunc) MainFrame_onRuneT, self);
     Input_addKeyEventHandler(self->app->input, SDL_SCANCODE_TAB, (EventHandlerFunc) MainFrame_onTabulation, self);
     Input_addKeyEventHandler(self->app->input, SDL_SCANCODE_H, (EventHandlerFunc) MainFrame_onRuneH, self);
+    Input_addKeyEventHandler(self->app->input, SDL_SCANCODE_N, (EventHandlerFunc) MainFrame_onRuneN, self);
 
     Input_addEventHandler(self->app->input, SDL_MOUSEBUTTONDOWN, (EventHandlerFunc) MainFrame_onClick, self);
     Input_addEventHandler(self->app->input, SDL_MOUSEMOTION, (EventHandlerFunc) MainFrame_onMouseMove, self);
     Input_addEventHandler(self->app->input, SDL_WINDOWEVENT, (EventHandlerFunc) MainFrame_onWindowResize, self);
+    Input_addEventHandler(self->app->input, SDL_MOUSEBUTTONUP, (EventHandlerFunc) MainFrame_onSettingsPointer, self);
+    Input_addEventHandler(self->app->input, SDL_MOUSEWHEEL, (EventHandlerFunc) MainFrame_onSettingsPointer, self);
 }
 
 void MainFrame_unfocus(MainFrame* self) {
@@ -418,10 +523,13 @@ void MainFrame_unfocus(MainFrame* self) {
     Input_removeOneKeyEventHandler(self->app->input, SDL_SCANCODE_B, self);
     Input_removeOneKeyEventHandler(self->app->input, SDL_SCANCODE_TAB, self);
     Input_removeOneKeyEventHandler(self->app->input, SDL_SCANCODE_H, self);
+    Input_removeOneKeyEventHandler(self->app->input, SDL_SCANCODE_N, self);
 
     Input_removeOneEventHandler(self->app->input, SDL_MOUSEBUTTONDOWN, self);
     Input_removeOneEventHandler(self->app->input, SDL_MOUSEMOTION, self);
     Input_removeOneEventHandler(self->app->input, SDL_WINDOWEVENT, self);
+    Input_removeOneEventHandler(self->app->input, SDL_MOUSEBUTTONUP, self);
+    Input_removeOneEventHandler(self->app->input, SDL_MOUSEWHEEL, self);
 }
 
 Frame* MainFrame_getFrame(MainFrame* self) {
@@ -446,7 +554,7 @@ static void MainFrame_onEscape(Input* input, SDL_Event* evt, MainFrame* self) {
     self->hovered_help = false;
     MainFrame_updateHelpImage(self);
     self->box_anim_progress = 0.f;
-    Element* settings = Element_getById(self->elements, "settings");
+    Element* settings = Element_getById(self->elements_by_id, "settings");
     Container* container = settings->data.container;
     self->box_start_x = container->box->position->x;
     self->box_target_x = self->showSettings ? w - self->settings_width : w;
@@ -479,7 +587,6 @@ static void MainFrame_onRuneS(Input* input, SDL_Event* evt, MainFrame* self) {
         }
         ColumnGraph_shuffleBars(self->graph[self->selected_graph_index]);
     }
-    MainFrame_addElements(self, self->app);
 }
 
 static bool MainFrame_createPopup(MainFrame* self, void* value, ColumnGraphType type) {
@@ -532,6 +639,7 @@ static bool MainFrame_createPopup(MainFrame* self, void* value, ColumnGraphType
     }
 
     Container_addChild(self->popup, Element_fromText(popupLabel, NULL));
+    Container_setCacheLayer(self->popup, true);
 
     return true;
 }
@@ -616,7 +724,7 @@ static void MainFrame_updateGraphs(MainFrame* self, int old_count, int old_bar_c
             ColumnGraph_initBarsIncrement(self->graph[i], self->bar_count, self->graph_style);
         }
     }
-    MainFrame_addElements(self, self->app);
+    self->settings_dirty = true;
 }
 
 static void MainFrame_onRuneP(Input* input, SDL_Event* evt, MainFrame* self) {
@@ -668,6 +776,7 @@ static int MainFrame_sortGraphThread(void* ptr) {
     if (!arg || !arg->self) return 1;
     MainFrame* self = arg->self;
     int graph_index = arg->graph_index;
+    Trace_setThreadName("Sort graph %d", graph_index + 1);
     self->graph_sorting[graph_index] = true;
     SDL_mutex* gm = self->graph_mutexes[graph_index];
 
@@ -679,7 +788,9 @@ static int MainFrame_sortGraphThread(void* ptr) {
     SDL_UnlockMutex(self->ui_mutex);
 
     self->graph[graph_index]->sort_in_progress = true;
-    ColumnGraph_sortGraph(self->graph[graph_index], gm, MainFrame_DelaySort, self);
+    TRACE_SCOPE("Sort") {
+        ColumnGraph_sortGraph(self->graph[graph_index], gm, MainFrame_DelaySort, self);
+    }
 
     self->graph_sorting[graph_index] = false;
     self->graph[graph_index]->sort_in_progress = false;
@@ -699,7 +810,7 @@ static void MainFrame_onSpace(Input* input, SDL_Event* evt, MainFrame* self) {
 
     for (int i = 0; i < graph_to_sort; i++) {
         int idx = self->all_selected ? i : self->selected_graph_index;
-        if (List_isSorted(self->graph[idx]->bars, ColumnGraphBar_compare)) {
+        if (Vector_isSorted(self->graph[idx]->bars, ColumnGraphBar_compare)) {
             if (self->popup) {
                 ColumnGraph_removeHovering(self->graph[idx]);
             }
@@ -711,7 +822,7 @@ static void MainFrame_onSpace(Input* input, SDL_Event* evt, MainFrame* self) {
             continue;
         }
         if (self->graph[idx]->sort_type == LIST_SORT_TYPE_BITONIC && !
-            is_power_of_two(List_size(self->graph[idx]->bars))) {
+            is_power_of_two(Vector_size(self->graph[idx]->bars))) {
             log_message(LOG_LEVEL_WARN,
                         "Cannot sort graph %d with Bitonic sort as the number of bars is not a power of two", idx+1);
             MainFrame_showCustomSizeTempTextf(self, 22,
@@ -730,38 +841,46 @@ static void MainFrame_DelaySort(MainFrame* self, ColumnGraph* graph, ColumnGraph
         log_message(LOG_LEVEL_WARN, "No graph to sort");
         return;
     }
-    UNUSED(self);
-    if (actual) {
-        actual->element->data.box->background = ColumnGraph_getHoverColor(graph->graph_style);
-    }
-    if (second) {
-        second->element->data.box->background = ColumnGraph_getHoverColor(graph->graph_style);
-    }
+    Trace_begin("Delay");
+    Profiler_countOp(self->app->profiler, graph->graph_index);
+    MainFrame_playBarTone(graph, actual);
+    MainFrame_playBarTone(graph, second);
+    // Parallel sorts call this from every thread: only the graph changes are serialized, not the sleep.
+    SDL_mutex* gm = self->graph_mutexes[graph->graph_index];
+    SDL_LockMutex(gm);
+    ColumnGraphBar_setHighlighted(actual, true);
+    ColumnGraphBar_setHighlighted(second, true);
     ColumnGraph_resetContainer(graph);
+    SDL_UnlockMutex(gm);
     //TODO adjust delay based on number of bars
     int delay = self->automatic_delay ? 7 : self->delay_ms;
     SDL_Delay(delay);
-    if (actual) {
-        actual->element->data.box->background = Color_copy(actual->color);
-    }
-    if (second) {
-        second->element->data.box->background = Color_copy(second->color);
-    }
+    SDL_LockMutex(gm);
+    ColumnGraphBar_setHighlighted(actual, false);
+    ColumnGraphBar_setHighlighted(second, false);
+    SDL_UnlockMutex(gm);
     while (graph->paused) {
         SDL_Delay(1);
     }
+    Trace_end("Delay");
+}
+
+static void MainFrame_playBarTone(ColumnGraph* graph, ColumnGraphBar* bar) {
+    if (!bar || graph->size.height <= 0) return;
+    // The bar height is its value relative to the largest one, whatever the graph type.
+    Audio_pushTone(graph->graph_index, bar->element->data.box->size.height / graph->size.height);
 }
 
 static void MainFrame_onEnter(Input* input, SDL_Event* evt, MainFrame* self) {
     UNUSED(input);
     UNUSED(evt);
     if (!self || !self->showSettings || MainFrame_isGraphSorting(self)) return;
-    Container* container = Element_getById(self->elements, "settings")->data.container;
+    Container* container = Element_getById(self->elements_by_id, "settings")->data.container;
 
-    InputBox* inputBar = Element_getById(container->children, "inputBar")->data.input_box;
-    InputBox* inputGraph = Element_getById(container->children, "inputGraph")->data.input_box;
-    InputBox* inputDelay = Element_getById(container->children, "inputDelay") ?
-                        Element_getById(container->children, "inputDelay")->data.input_box : NULL;
+    InputBox* inputBar = Container_getChildById(container, "inputBar")->data.input_box;
+    InputBox* inputGraph = Container_getChildById(container, "inputGraph")->data.input_box;
+    InputBox* inputDelay = Container_getChildById(container, "inputDelay") ?
+                        Container_getChildById(container, "inputDelay")->data.input_box : NULL;
     if (!String_isNumeric(InputBox_getString(inputBar)) || !String_isNumeric(InputBox_getString(inputGraph))) {
         return;
     }
@@ -867,30 +986,19 @@ static void MainFrame_loadFileCallback(MainFrame* self, const char* filename) {
     if (self->all_selected) {
         for (int i = 0; i < self->graph_count; i++) {
             ColumnGraph* graph = self->graph[i];
-            ListIterator* it = ListIterator_new(graph->bars);
-            while (ListIterator_hasNext(it)) {
-                ColumnGraphBar_destroy(ListIterator_next(it));
-            }
-            ListIterator_destroy(it);
-            List_clear(graph->bars);
+            ColumnGraph_resetBars(graph);
             ColumnGraph_setGraphType(graph, type);
             FlexContainer_clear(graph->container);
             ColumnGraph_initBars(graph, values_len, values, self->graph_style);
         }
     } else {
         ColumnGraph* graph = self->graph[self->selected_graph_index];
-        ListIterator* it = ListIterator_new(graph->bars);
-        while (ListIterator_hasNext(it)) {
-            ColumnGraphBar_destroy(ListIterator_next(it));
-        }
-        ListIterator_destroy(it);
-        List_clear(graph->bars);
+        ColumnGraph_resetBars(graph);
         ColumnGraph_setGraphType(graph, type);
         FlexContainer_clear(graph->container);
         ColumnGraph_initBars(graph, values_len, values, self->graph_style);
     }
     safe_free((void **) &values);
-    MainFrame_addElements(self, self->app);
 }
 
 static void MainFrame_loadFile(Input* input, SDL_Event* evt, Button* button) {
@@ -910,15 +1018,32 @@ static void MainFrame_loadFile(Input* input, SDL_Event* evt, Button* button) {
             );
             if (filePath) {
                 const char* paths[1] = {filePath};
-                MainFrame_loadFileCallback(mainFrame, paths[0]);
+                TRACE_SCOPE("Load file") {
+                    MainFrame_loadFileCallback(mainFrame, paths[0]);
+                }
             }
         }
     }
 }
 
-static void MainFrame_onClick(Input* input, SDL_Event* evt, MainFrame* self) {
+static void MainFrame_onSettingsPointer(Input* input, SDL_Event* evt, MainFrame* self) {
     UNUSED(input);
     UNUSED(evt);
+    if (!self || !self->showSettings) return;
+    // Widgets only repaint while the pointer is over the panel, plus once when it leaves to drop their hover state.
+    Container* container = Element_getById(self->elements_by_id, "settings")->data.container;
+    Position* position = Container_getPosition(container);
+    Size size = Container_getSize(container);
+    SDL_FRect rect = {position->x, position->y, size.width, size.height};
+    bool inside = Input_mouseInRect(self->app->input, rect);
+    if (inside || self->settings_hovered) {
+        Container_markDirty(container);
+    }
+    self->settings_hovered = inside;
+}
+
+static void MainFrame_onClick(Input* input, SDL_Event* evt, MainFrame* self) {
+    MainFrame_onSettingsPointer(input, evt, self);
     if (!self || self->graph_info || MainFrame_isGraphSorting(self) || self->seed_container || self->sort_type_container) return;
     float x, y;
     Input_getMousePosition(self->app->input, &x, &y);
@@ -939,14 +1064,13 @@ static void MainFrame_onClick(Input* input, SDL_Event* evt, MainFrame* self) {
                     }
                 }
                 self->selected_graph_index = i;
-                MainFrame_addElements(self, self->app);
                 break;
             }
         }
     }
     if (!self->showSettings) return;
-    Container* container = Element_getById(self->elements, "settings")->data.container;
-    Image* image_help = Element_getById(container->children, "help_image")->data.image;
+    Container* container = Element_getById(self->elements_by_id, "settings")->data.container;
+    Image* image_help = Container_getChildById(container, "help_image")->data.image;
     Size size_help_image = Image_getSize(image_help);
     Position* position_help_image = image_help->position;
     SDL_FRect help_rect = {
@@ -965,7 +1089,6 @@ static void MainFrame_onRuneA(Input* input, SDL_Event* evt, MainFrame* self) {
     if (!self || self->showSettings || self->graph_info || MainFrame_isGraphSorting(self) || self->seed_container || self->sort_type_container) return;
     self->all_selected = !self->all_selected;
     MainFrame_showTempTextf(self, self->all_selected ? "All Graphs Selected" : "Single Graph Selected (Graph %d)", self->selected_graph_index+1);
-    MainFrame_addElements(self, self->app);
 }
 
 static void MainFrame_onGraphThemeChange(Input* input, SDL_Event* evt, Select* select) {
@@ -989,13 +1112,38 @@ static void MainFrame_onGraphThemeChange(Input* input, SDL_Event* evt, Select* s
     }
 }
 
+static ColumnGraph* MainFrame_getGraphAt(MainFrame* self, float x, float y) {
+    if (self->graph_count <= 0 || x < 0 || y < 0) return NULL;
+    // Graphs share one size and are tiled two per row (one when alone), see MainFrame_updateGraphs.
+    Size slot = self->graph[0]->size;
+    if (slot.width <= 0 || slot.height <= 0) return NULL;
+    int columns = self->graph_count == 1 ? 1 : 2;
+    int column = (int) (x / slot.width);
+    int row = (int) (y / slot.height);
+    if (column >= columns) return NULL;
+    int index = row * columns + column;
+    return index < self->graph_count ? self->graph[index] : NULL;
+}
+
+static void MainFrame_updateGraphHover(MainFrame* self, float x, float y) {
+    ColumnGraph* target = MainFrame_getGraphAt(self, x, y);
+    for (int i = 0; i < self->graph_count; i++) {
+        // A sorting graph owns its bar colors, so its hover state is left alone like in ColumnGraph_handleMouseMotion.
+        if (self->graph[i] != target && self->graph[i]->hovered && !self->graph[i]->sort_in_progress) {
+            ColumnGraph_removeHovering(self->graph[i]);
+        }
+    }
+    ColumnGraph_handleMouseMotion(target, x, y);
+}
+
 static void MainFrame_onMouseMove(Input* input, SDL_Event* evt, MainFrame* self) {
-    UNUSED(input);
-    UNUSED(evt);
-    if (!self || self->graph_info || MainFrame_isGraphSorting(self) || self->seed_container || self->sort_type_container) return;
+    MainFrame_onSettingsPointer(input, evt, self);
+    if (!self) return;
+    MainFrame_updateGraphHover(self, evt->motion.x, evt->motion.y);
+    if (self->graph_info || MainFrame_isGraphSorting(self) || self->seed_container || self->sort_type_container) return;
     if (self->showSettings) {
-        Container* container = Element_getById(self->elements, "settings")->data.container;
-        Image* img = Element_getById(container->children, "help_image")->data.image;
+        Container* container = Element_getById(self->elements_by_id, "settings")->data.container;
+        Image* img = Container_getChildById(container, "help_image")->data.image;
         Size imgSize = Image_getSize(img);
         SDL_FRect rect = {img->position->x, img->position->y, imgSize.width, imgSize.height};
         if (Input_mouseInRect(self->app->input, rect)) {
@@ -1009,8 +1157,8 @@ static void MainFrame_onMouseMove(Input* input, SDL_Event* evt, MainFrame* self)
 }
 
 static void MainFrame_updateHelpImage(MainFrame* self) {
-    Container* container = Element_getById(self->elements, "settings")->data.container;
-    Image* img = Element_getById(container->children, "help_image")->data.image;
+    Container* container = Element_getById(self->elements_by_id, "settings")->data.container;
+    Image* img = Container_getChildById(container, "help_image")->data.image;
     Image_changePath(img, self->app, "help_white.svg");
 }
 
@@ -1030,11 +1178,17 @@ static void MainFrame_onWindowResize(Input* input, SDL_Event* evt, MainFrame* se
         return;
     }
     MainFrame_updateGraphs(self, self->graph_count, self->bar_count);
-    MainFrame_addElements(self, self->app);
+    self->layout_dirty = true;
 }
 
 static void MainFrame_onRuneI(Input* input, SDL_Event* evt, MainFrame* self) {
     if (!self || self->showSettings || MainFrame_isGraphSorting(self)) return;
+    if (input->shift) {
+        if (!self->graph_info) {
+            MainFrame_onShiftI(input, evt, self);
+        }
+        return;
+    }
     if (self->all_selected && self->graph_count > 1) return;
     UNUSED(input);
     UNUSED(evt);
@@ -1053,12 +1207,16 @@ static void MainFrame_showGraphInfo(MainFrame* self, int index, ColumnGraph* gra
     UNUSED(graph);
     int w, h;
     SDL_GetWindowSize(self->app->window, &w, &h);
-    float graph_info_width = 350;
-    float graph_info_height = 250;
+    int pass_count = GraphStats_getPassCount(graph->stats);
+    int shown_passes = pass_count < MAIN_FRAME_INFO_MAX_PASSES ? pass_count : MAIN_FRAME_INFO_MAX_PASSES;
+    // The pass lines need more room than the other lines.
+    float graph_info_width = pass_count > 0 ? 480 : 350;
+    float graph_info_height = 280 + (shown_passes + (pass_count > shown_passes)) * 22;
     SDL_Renderer* renderer = self->app->renderer;
     self->graph_info = Container_new(w / 2, h / 2, graph_info_width, graph_info_height, true,
                                      Color_copy(self->app->theme->background), self);
     Box_setBorder(self->graph_info->box, 4, Color_copy(COLOR_WHITE));
+    Container_setCacheLayer(self->graph_info, true);
     Position* graph_info_pos = Container_getPosition(self->graph_info);
     Text* graph_title = Text_newf(renderer, TextStyle_new(
                                       ResourceManager_getDefaultBoldFont(self->app->manager, 24),
@@ -1092,14 +1250,39 @@ static void MainFrame_showGraphInfo(MainFrame* self, int index, ColumnGraph* gra
                                      Position_new(graph_info_pos->x + 10, y),
                                      false,
                                      "Is Sorted: %s",
-                                     List_isSorted(graph->bars, ColumnGraphBar_compare) ? "Yes" : "No");
+                                     Vector_isSorted(graph->bars, ColumnGraphBar_compare) ? "Yes" : "No");
 
     y += 30;
 
+    char sort_type_name[64];
+    if (graph->sort_type == LIST_SORT_TYPE_SHELL) {
+        String_formatTo(sort_type_name, sizeof(sort_type_name), "%s (%s gaps)",
+                        ListSortType_toString(graph->sort_type), ShellGapSequence_toString(graph->shell_gaps));
+    } else {
+        String_formatTo(sort_type_name, sizeof(sort_type_name), "%s", ListSortType_toString(graph->sort_type));
+    }
     Text* sort_type_text = Text_newf(renderer, TextStyle_deepCopy(base_text_style),
                                      Position_new(graph_info_pos->x + 10, y),
                                      false,
-                                     "Sort Type: %s", ListSortType_toString(graph->sort_type));
+                                     "Sort Type: %s", sort_type_name);
+
+    y += 30;
+
+    size_t peak_aux = GraphStats_getPeakAuxBytes(graph->stats);
+    Text* aux_memory_text = peak_aux < 1024
+        ? Text_newf(renderer, TextStyle_deepCopy(base_text_style), Position_new(graph_info_pos->x + 10, y), false,
+                    "Peak Aux Memory: %zu B", peak_aux)
+        : Text_newf(renderer, TextStyle_deepCopy(base_text_style), Position_new(graph_info_pos->x + 10, y), false,
+                    "Peak Aux Memory: %.1f KB", (double) peak_aux / 1024.0);
+
+    y += 30;
+
+    Text* weighted_cost_text = Text_newf(renderer, TextStyle_deepCopy(base_text_style),
+                                         Position_new(graph_info_pos->x + 10, y),
+                                         false,
+                                         "Weighted Cost: %ld (writes x%d)",
+                                         GraphStats_getWeightedCost(graph->stats),
+                                         GraphStats_getWriteCost(graph->stats));
 
     y += 30;
     Text* seed_text = NULL;
@@ -1115,25 +1298,52 @@ static void MainFrame_showGraphInfo(MainFrame* self, int index, ColumnGraph* gra
     Container_addChild(self->graph_info, Element_fromText(bar_count_text, NULL));
     Container_addChild(self->graph_info, Element_fromText(is_sorted_text, NULL));
     Container_addChild(self->graph_info, Element_fromText(sort_type_text, NULL));
+    Container_addChild(self->graph_info, Element_fromText(aux_memory_text, NULL));
+    Container_addChild(self->graph_info, Element_fromText(weighted_cost_text, NULL));
     if (seed_text) {
         Container_addChild(self->graph_info, Element_fromText(seed_text, NULL));
+        y += 30;
+    }
+
+    // Multi-pass sorts (Shell sort gaps) list what each pass did, largest gap first.
+    TextStyle* pass_text_style = TextStyle_new(
+        ResourceManager_getDefaultFont(self->app->manager, 16),
+        16, COLOR_WHITE, TTF_STYLE_NORMAL);
+    for (int i = 0; i < shown_passes; i++) {
+        const GraphStatsPass* pass = GraphStats_getPass(graph->stats, i);
+        Text* pass_text = Text_newf(renderer, TextStyle_deepCopy(pass_text_style),
+                                    Position_new(graph_info_pos->x + 20, y),
+                                    false,
+                                    "Gap %ld: %d comparisons, %d moves, %d reads, %d writes",
+                                    pass->gap, pass->comparisons, pass->swaps, pass->reads, pass->writes);
+        Container_addChild(self->graph_info, Element_fromText(pass_text, NULL));
+        y += 22;
+    }
+    if (pass_count > shown_passes) {
+        Text* more_text = Text_newf(renderer, TextStyle_deepCopy(pass_text_style),
+                                    Position_new(graph_info_pos->x + 20, y),
+                                    false,
+                                    "... %d more passes", pass_count - shown_passes);
+        Container_addChild(self->graph_info, Element_fromText(more_text, NULL));
     }
+    TextStyle_destroy(pass_text_style);
 
     Position_destroy(graph_info_pos);
-    MainFrame_addElements(self, self->app);
+    MainFrame_showElement(self, Element_fromContainer(self->graph_info, "graph_info"));
 }
 
 static void MainFrame_hideGraphInfo(MainFrame* self) {
     if (!self->graph_info) return;
-    Container_destroy(self->graph_info);
+    MainFrame_removeElement(self, "graph_info");
     self->graph_info = NULL;
-    MainFrame_addElements(self, self->app);
 }
 
 static void MainFrame_onRuneO(Input* input, SDL_Event* evt, MainFrame* self) {
     if (!self || self->showSettings || self->graph_info || MainFrame_isGraphSorting(self) || self->seed_container || self->sort_type_container) return;
-    UNUSED(input);
-    UNUSED(evt);
+    if (input->shift) {
+        MainFrame_onShiftO(input, evt, self);
+        return;
+    }
     int graph_count = self->all_selected ? self->graph_count : 1;
     ListSortType newSortType = modulo(self->graph[self->all_selected ? 0 : self->selected_graph_index]->sort_type + 1,
                                       LIST_SORT_TYPE_COUNT);
@@ -1145,6 +1355,34 @@ static void MainFrame_onRuneO(Input* input, SDL_Event* evt, MainFrame* self) {
     MainFrame_showTempTextf(self, "Sort Type: %s", ListSortType_toString(newSortType));
 }
 
+static void MainFrame_onShiftO(Input* input, SDL_Event* evt, MainFrame* self) {
+    UNUSED(input);
+    UNUSED(evt);
+    int graph_count = self->all_selected ? self->graph_count : 1;
+    ShellGapSequence newGaps = modulo(self->graph[self->all_selected ? 0 : self->selected_graph_index]->shell_gaps + 1,
+                                      SHELL_GAPS_COUNT);
+    for (int i = 0; i < graph_count; i++) {
+        int idx = self->all_selected ? i : self->selected_graph_index;
+        ColumnGraph_setShellGaps(self->graph[idx], newGaps);
+    }
+    MainFrame_showTempTextf(self, "Shell Sort Gaps: %s", ShellGapSequence_toString(newGaps));
+}
+
+static void MainFrame_onShiftI(Input* input, SDL_Event* evt, MainFrame* self) {
+    UNUSED(input);
+    UNUSED(evt);
+    int graph_count = self->all_selected ? self->graph_count : 1;
+    int write_cost = GraphStats_getWriteCost(self->graph[self->all_selected ? 0 : self->selected_graph_index]->stats) * 2;
+    if (write_cost > GRAPH_STATS_MAX_WRITE_COST) {
+        write_cost = 1;
+    }
+    for (int i = 0; i < graph_count; i++) {
+        int idx = self->all_selected ? i : self->selected_graph_index;
+        GraphStats_setWriteCost(self->graph[idx]->stats, write_cost);
+    }
+    MainFrame_showTempTextf(self, "Write Cost: x%d", write_cost);
+}
+
 static bool MainFrame_isGraphSorting(MainFrame* self) {
     for (int i = 0; i < self->graph_count; i++) {
         if (self->graph_sorting[i]) {
@@ -1183,9 +1421,8 @@ static void MainFrame_showTempTextf(MainFrame* self, const char* format, ...) {
 }
 
 static void MainFrame_showCustomSizeTempText(MainFrame* self, int font_size, const char* text) {
-    Element* copy_temp_element = NULL;;
     if (self->temp_element) {
-        copy_temp_element = self->temp_element;
+        MainFrame_removeElement(self, "temp_text");
         self->temp_element = NULL;
     }
     int w, h;
@@ -1202,12 +1439,9 @@ static void MainFrame_showCustomSizeTempText(MainFrame* self, int font_size, con
                                              font_size, COLOR_YELLOW, TTF_STYLE_BOLD),
                                          Position_new(x, y),
                                          true, text);
-    self->temp_element = Element_fromText(temp_new_sort_text, NULL);
+    self->temp_element = Element_fromText(temp_new_sort_text, "temp_text");
+    MainFrame_showElement(self, self->temp_element);
     Timer_start(self->timer);
-    MainFrame_addElements(self, self->app);
-    if (copy_temp_element) {
-        Element_destroy(copy_temp_element);
-    }
 }
 
 static void MainFrame_showCustomSizeTempTextf(MainFrame* self, int font_size, const char* format, ...) {
@@ -1233,7 +1467,8 @@ static void MainFrame_onCheckboxClicked(Input* input, SDL_Event* evt, Checkbox*
     if (!parent || !parent->parent) return;
     MainFrame* self = parent->parent;
     self->automatic_delay = Checkbox_isChecked(checkbox);
-    MainFrame_addElements(self, self->app);
+    // Deferred to the next update: the checkbox must not rebuild its own container mid-dispatch.
+    self->settings_dirty = true;
 }
 
 static void MainFrame_onChangeSeed(Input* input, SDL_Event* evt, Button* button) {
@@ -1242,7 +1477,7 @@ static void MainFrame_onChangeSeed(Input* input, SDL_Event* evt, Button* button)
     UNUSED(evt);
     Container* parent = button->parent;
     if (!parent || !parent->parent) return;
-    InputBox* inputBox = Element_getById(parent->children, "seed_input")->data.input_box;
+    InputBox* inputBox = Container_getChildById(parent, "seed_input")->data.input_box;
     if (!inputBox) return;
     MainFrame* self = parent->parent;
     const char* seed_str = InputBox_getString(inputBox);
@@ -1250,9 +1485,8 @@ static void MainFrame_onChangeSeed(Input* input, SDL_Event* evt, Button* button)
         long seed = atol(seed_str);
         self->seed = seed;
         MainFrame_showTempTextf(self, "Seed set to %ld", seed);
-        Container_destroy(self->seed_container);
+        MainFrame_removeElement(self, "seed_container");
         self->seed_container = NULL;
-        MainFrame_addElements(self, self->app);
         MainFrame_updateGraphs(self, self->graph_count, self->bar_count);
     } else {
         MainFrame_showTempText(self, "Invalid seed value");
@@ -1268,18 +1502,16 @@ static void MainFrame_onResetSeed(Input* input, SDL_Event* evt, Button* button)
     MainFrame* self = parent->parent;
     srand((unsigned int) time(NULL));
     MainFrame_showTempText(self, "Seed reset to current time");
-    Container_destroy(self->seed_container);
+    MainFrame_removeElement(self, "seed_container");
     self->seed_container = NULL;
-    MainFrame_addElements(self, self->app);
 }
 
 static void MainFrame_onShiftS(Input* input, SDL_Event* evt, MainFrame* self) {
     UNUSED(input);
     UNUSED(evt);
     if (self->seed_container) {
-        Container_destroy(self->seed_container);
+        MainFrame_removeElement(self, "seed_container");
         self->seed_container = NULL;
-        MainFrame_addElements(self, self->app);
         return;
     }
     int w, h;
@@ -1316,7 +1548,7 @@ static void MainFrame_onShiftS(Input* input, SDL_Event* evt, MainFrame* self) {
     Container_addChild(self->seed_container, Element_fromInput(seed_input, "seed_input"));
     Container_addChild(self->seed_container, Element_fromButton(saveButton, NULL));
     Container_addChild(self->seed_container, Element_fromButton(resetButton, NULL));
-    MainFrame_addElements(self, self->app);
+    MainFrame_showElement(self, Element_fromContainer(self->seed_container, "seed_container"));
 }
 
 static void MainFrame_changeSortType(Input* input, SDL_Event* evt, Button* button) {
@@ -1336,9 +1568,8 @@ static void MainFrame_changeSortType(Input* input, SDL_Event* evt, Button* butto
         ColumnGraph_setSortType(graph, newSortType);
     }
     MainFrame_showTempTextf(self, "Sort Type: %s", ListSortType_toString(newSortType));
-    Container_destroy(self->sort_type_container);
+    MainFrame_removeElement(self, "sort_type_container");
     self->sort_type_container = NULL;
-    MainFrame_addElements(self, self->app);
 }
 
 static void MainFrame_onTabulation(Input* input, SDL_Event* evt, MainFrame* self) {
@@ -1346,17 +1577,19 @@ static void MainFrame_onTabulation(Input* input, SDL_Event* evt, MainFrame* self
     UNUSED(evt);
     if (!self || self->showSettings || self->graph_info || MainFrame_isGraphSorting(self) || self->seed_container) return;
     if (self->sort_type_container) {
-        Container_destroy(self->sort_type_container);
+        MainFrame_removeElement(self, "sort_type_container");
         self->sort_type_container = NULL;
-        MainFrame_addElements(self, self->app);
         return;
     }
     int w, h;
     SDL_GetWindowSize(self->app->window, &w, &h);
     float button_default_width = 200;
     float button_default_height = 40;
-    float container_width = button_default_width * 2 + 60;
-    float container_height = 350;
+    // A third column keeps the popup inside the default window once the list grows.
+    int columns = LIST_SORT_TYPE_COUNT > 8 ? 3 : 2;
+    int rows = (LIST_SORT_TYPE_COUNT + columns - 1) / columns;
+    float container_width = button_default_width * columns + 30 * (columns - 1) + 30;
+    float container_height = fmaxf(350, 80 + rows * (button_default_height + 20) + 10);
     self->sort_type_container = Container_new(w / 2, h / 2, container_width, container_height, true,
                                               Color_copy(self->app->theme->background), self);
     Box_setBorder(self->sort_type_container->box, 4, Color_copy(COLOR_WHITE));
@@ -1382,13 +1615,13 @@ static void MainFrame_onTabulation(Input* input, SDL_Event* evt, MainFrame* self
         ListSortType t = (ListSortType) i;
         Button* sort_button = Button_new(self->app, POSITION_NULL, true, ButtonStyle_default(self->app->manager),
                                         self->sort_type_container, ListSortType_toString(t));
-        float xPos = sort_pos->x + 45 + (i % 2) * (button_default_width + 30);
-        float yPos = sort_pos->y + 80 + (i / 2) * (button_default_height + 20);
+        float xPos = sort_pos->x + 45 + (i % columns) * (button_default_width + 30);
+        float yPos = sort_pos->y + 80 + (i / columns) * (button_default_height + 20);
         Button_setPosition(sort_button, xPos, yPos);
         Button_onClick(sort_button, (EventHandlerFunc) MainFrame_changeSortType);
         Container_addChild(self->sort_type_container, Element_fromButton(sort_button, NULL));
     }
-    MainFrame_addElements(self, self->app);
+    MainFrame_showElement(self, Element_fromContainer(self->sort_type_container, "sort_type_container"));
 }
 
 static void MainFrame_onShiftSpace(Input* input, SDL_Event* evt, MainFrame* self) {
@@ -1415,7 +1648,6 @@ static void MainFrame_onShiftSpace(Input* input, SDL_Event* evt, MainFrame* self
         self->graph[i]->prng = NULL;
     }
     self->all_selected = true;
-    MainFrame_addElements(self, self->app);
 }
 
 static void MainFrame_onRuneH(Input* input, SDL_Event* evt, MainFrame* self) {
@@ -1423,4 +1655,20 @@ static void MainFrame_onRuneH(Input* input, SDL_Event* evt, MainFrame* self) {
     UNUSED(input);
     UNUSED(evt);
     App_addFrame(self->app, HelpFrame_getFrame(HelpFrame_new(self->app)));
-}
\ No newline at end of file
+}
+
+static void MainFrame_onRuneN(Input* input, SDL_Event* evt, MainFrame* self) {
+    if (!self || self->showSettings || self->seed_container || self->sort_type_container) return;
+    UNUSED(input);
+    UNUSED(evt);
+    Audio_setSonification(!Audio_isSonificationEnabled());
+    bool enabled = Audio_isSonificationEnabled();
+    // Rendered once by the resource manager, then replayed from its cache.
+    if (Mix_QuerySpec(NULL, NULL, NULL)) {
+        Audio_play(ResourceManager_getTone(self->app->manager, WAVEFORM_TRIANGLE,
+                                           enabled ? AUDIO_SOUND_ON_FREQUENCY : AUDIO_SOUND_OFF_FREQUENCY,
+                                           AUDIO_TOGGLE_TONE_MS),
+                   MIX_MAX_VOLUME / 4, false);
+    }
+    MainFrame_showTempText(self, enabled ? "Sound on" : "Sound off");
+}
@@ -9,20 +9,27 @@
 #include "utils.h"
 #include "string_builder.h"
 
+static Uint32 Map_hashString(const char* key);
+static Uint32 Map_hashInt(const void* key);
+static Uint32 Map_hash(const Map* map, const void* key);
+static bool Map_keyEquals(const Map* map, const MapNode* node, const void* key, Uint32 hash);
+static MapNode* Map_findHashed(Map* map, const void* key, Uint32 hash);
+static void Map_insertNode(Map* map, void* key, void* value, Uint32 hash);
+static bool Map_resize(Map* map, size_t capacity);
+
 Map* Map_create(bool is_key_string) {
     Map* map = calloc(1, sizeof(Map));
     if (!map) {
         error("Failed to allocate memory for Map");
         return NULL;
     }
-    map->root = calloc(1, sizeof(MapNode));
-    if (!map->root) {
+    map->nodes = calloc(MAP_INITIAL_CAPACITY, sizeof(MapNode));
+    if (!map->nodes) {
         error("Failed to allocate memory for MapNode");
         safe_free((void**)&map);
         return NULL;
     }
-    map->root->prev = map->root;
-    map->root->next = map->root;
+    map->capacity = MAP_INITIAL_CAPACITY;
     map->is_key_string = is_key_string;
     map->size = 0;
     return map;
@@ -30,43 +37,102 @@ Map* Map_create(bool is_key_string) {
 
 void Map_destroy(Map* map) {
     if (!map) return;
-    Map_clear(map);
-    safe_free((void**)&map->root);
+    safe_free((void**)&map->nodes);
     safe_free((void**)&map);
 }
 
 void Map_clear(Map* map) {
-    MapNode* node = map->root->next;
-    while (node != map->root) {
-        MapNode* next = node->next;
-        if (node == map->root && next == map->root) break;
-        safe_free((void**)&node);
-        node = next;
+    memset(map->nodes, 0, map->capacity * sizeof(MapNode));
+    map->size = 0;
+}
+
+// FNV-1a, cheap and good enough for the short file names and ids used as keys.
+static Uint32 Map_hashString(const char* key) {
+    Uint32 hash = 2166136261u;
+    if (!key) return hash;
+    for (const unsigned char* c = (const unsigned char*)key; *c; c++) {
+        hash ^= *c;
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+// Integer keys (scancodes, event types, sizes) are small and sequential: mix the bits
+// (murmur3 finalizer) so they spread across the table instead of clustering.
+static Uint32 Map_hashInt(const void* key) {
+    Uint64 h = (Uint64)(uintptr_t)key;
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ULL;
+    h ^= h >> 33;
+    return (Uint32)h;
+}
+
+static Uint32 Map_hash(const Map* map, const void* key) {
+    return map->is_key_string ? Map_hashString(key) : Map_hashInt(key);
+}
+
+static bool Map_keyEquals(const Map* map, const MapNode* node, const void* key, Uint32 hash) {
+    if (map->is_key_string) {
+        return node->hash == hash && String_equals(node->key, key);
+    }
+    return node->key == key;
+}
+
+static void Map_insertNode(Map* map, void* key, void* value, Uint32 hash) {
+    size_t mask = map->capacity - 1;
+    MapNode entry = { key, value, hash, 1 };
+    size_t i = hash & mask;
+    while (true) {
+        MapNode* node = &map->nodes[i];
+        if (node->probe == 0) {
+            *node = entry;
+            map->size++;
+            return;
+        }
+        // Robin hood: the entry further from its home slot takes the place.
+        if (node->probe < entry.probe) {
+            MapNode tmp = *node;
+            *node = entry;
+            entry = tmp;
+        }
+        entry.probe++;
+        i = (i + 1) & mask;
     }
+}
+
+static bool Map_resize(Map* map, size_t capacity) {
+    MapNode* old_nodes = map->nodes;
+    size_t old_capacity = map->capacity;
+    MapNode* nodes = calloc(capacity, sizeof(MapNode));
+    if (!nodes) {
+        error("Failed to allocate memory for MapNode");
+        return false;
+    }
+    map->nodes = nodes;
+    map->capacity = capacity;
     map->size = 0;
-    map->root->prev = map->root;
-    map->root->next = map->root;
+    for (size_t i = 0; i < old_capacity; i++) {
+        if (old_nodes[i].probe != 0) {
+            Map_insertNode(map, old_nodes[i].key, old_nodes[i].value, old_nodes[i].hash);
+        }
+    }
+    safe_free((void**)&old_nodes);
+    return true;
 }
 
 void Map_put(Map* map, void* key, void* value) {
-    if (Map_containsKey(map, key)) {
-        MapNode* curr = Map_find(map, key);
+    Uint32 hash = Map_hash(map, key);
+    MapNode* curr = Map_findHashed(map, key, hash);
+    if (curr) {
         curr->value = value;
         return;
     }
-    MapNode* node = calloc(1, sizeof(MapNode));
-    if (!node) {
-        error("Failed to allocate memory for MapNode");
+    if ((map->size + 1) * 4 > map->capacity * 3 && !Map_resize(map, map->capacity * 2)) {
         return;
     }
-    MapNode* last = map->root->prev;
-    map->root->prev = node;
-    node->key = key;
-    node->value = value;
-    node->prev = last;
-    node->next = map->root;
-    last->next = node;
-    map->size++;
+    Map_insertNode(map, key, value, hash);
 }
 
 void* Map_get(Map* map, void* key) {
@@ -78,20 +144,23 @@ void* Map_get(Map* map, void* key) {
 }
 
 MapNode* Map_find(Map* map, void* key) {
-    MapNode* node = map->root->next;
-    while (node != map->root) {
-        if (map->is_key_string) {
-            if (String_equals(node->key, key)) {
-                return node;
-            }
-        } else {
-            if (node->key == key) {
-                return node;
-            }
+    return Map_findHashed(map, key, Map_hash(map, key));
+}
+
+static MapNode* Map_findHashed(Map* map, const void* key, Uint32 hash) {
+    size_t mask = map->capacity - 1;
+    size_t i = hash & mask;
+    for (Uint32 probe = 1; ; probe++) {
+        MapNode* node = &map->nodes[i];
+        // An empty slot, or one closer to home than we are, ends the search.
+        if (node->probe < probe) {
+            return NULL;
+        }
+        if (Map_keyEquals(map, node, key, hash)) {
+            return node;
         }
-        node = node->next;
+        i = (i + 1) & mask;
     }
-    return NULL;
 }
 
 bool Map_containsKey(Map* map, void* key) {
@@ -99,12 +168,10 @@ bool Map_containsKey(Map* map, void* key) {
 }
 
 bool Map_containsValue(Map* map, void* value) {
-    MapNode* node = map->root->next;
-    while (node != map->root) {
-        if (node->value == value) {
+    for (size_t i = 0; i < map->capacity; i++) {
+        if (map->nodes[i].probe != 0 && map->nodes[i].value == value) {
             return true;
         }
-        node = node->next;
     }
     return false;
 }
@@ -114,11 +181,17 @@ void Map_remove(Map* map, void* key) {
     if (!node) {
         return;
     }
-    MapNode* prev = node->prev;
-    MapNode* next = node->next;
-    prev->next = next;
-    next->prev = prev;
-    safe_free((void**)&node);
+    // Backward-shift deletion keeps probe chains intact without tombstones.
+    size_t mask = map->capacity - 1;
+    size_t i = node - map->nodes;
+    size_t next = (i + 1) & mask;
+    while (map->nodes[next].probe > 1) {
+        map->nodes[i] = map->nodes[next];
+        map->nodes[i].probe--;
+        i = next;
+        next = (next + 1) & mask;
+    }
+    memset(&map->nodes[i], 0, sizeof(MapNode));
     map->size--;
 }
 
@@ -133,8 +206,10 @@ bool Map_isEmpty(Map* map) {
 char* Map_toString(Map* map, const char* keyFormat, const char* valueFormat, void* (*formatKeyFunc)(void* key), void* (*formatValueFunc)(void* value)) {
     StringBuilder* sb = StringBuilder_create(DEFAULT_CAPACITY);
     StringBuilder_append(sb, "{");
-    MapNode* node = map->root->next;
-    while (node != map->root) {
+    size_t printed = 0;
+    for (size_t i = 0; i < map->capacity; i++) {
+        MapNode* node = &map->nodes[i];
+        if (node->probe == 0) continue;
         void* key = node->key;
         void* value = node->value;
         void* formatKey = formatKeyFunc ? formatKeyFunc(key) : key;
@@ -149,8 +224,7 @@ char* Map_toString(Map* map, const char* keyFormat, const char* valueFormat, voi
         } else {
             StringBuilder_append_format(sb, valueFormat, formatValue);
         }
-        node = node->next;
-        if (node != map->root) {
+        if (++printed < map->size) {
             StringBuilder_append(sb, ", ");
         }
     }
@@ -166,8 +240,9 @@ MapIterator* MapIterator_new(Map* map) {
         error("Failed to allocate memory for MapIterator");
         return NULL;
     }
-    iterator->root = map->root;
-    iterator->current = map->root;
+    iterator->map = map;
+    iterator->current = NULL;
+    iterator->next = 0;
     return iterator;
 }
 
@@ -177,20 +252,23 @@ void MapIterator_destroy(MapIterator* iterator) {
 }
 
 bool MapIterator_hasNext(MapIterator* iterator) {
-    return iterator->current->next != iterator->root;
+    Map* map = iterator->map;
+    while (iterator->next < map->capacity && map->nodes[iterator->next].probe == 0) {
+        iterator->next++;
+    }
+    return iterator->next < map->capacity;
 }
 
 void MapIterator_next(MapIterator* iterator) {
     if (MapIterator_hasNext(iterator)) {
-        iterator->current = iterator->current->next;
+        iterator->current = &iterator->map->nodes[iterator->next++];
     }
 }
 
 void* MapIterator_key(MapIterator* iterator) {
-    return iterator->current->key;
+    return iterator->current ? iterator->current->key : NULL;
 }
 
 void* MapIterator_value(MapIterator* iterator) {
-    return iterator->current->value;
+    return iterator->current ? iterator->current->value : NULL;
 }
-
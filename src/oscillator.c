@@ -0,0 +1,41 @@
+/*
+ * Copyright (c) 2025 Torisutan
+ * ALl rights reserved
+ */
+#include "oscillator.h"
+
+static float oscillator_tables[WAVEFORM_COUNT][OSCILLATOR_TABLE_SIZE];
+static bool oscillator_tables_ready;
+
+void Oscillator_initTables() {
+    if (oscillator_tables_ready) return;
+    for (int i = 0; i < OSCILLATOR_TABLE_SIZE; i++) {
+        float t = (float) i / OSCILLATOR_TABLE_SIZE;
+        oscillator_tables[WAVEFORM_SINE][i] = sinf(2.f * (float) M_PI * t);
+        oscillator_tables[WAVEFORM_SQUARE][i] = t < 0.5f ? 1.f : -1.f;
+        // Starts at zero going up, like the sine.
+        oscillator_tables[WAVEFORM_TRIANGLE][i] = t < 0.25f ? 4.f * t : t < 0.75f ? 2.f - 4.f * t : 4.f * t - 4.f;
+    }
+    oscillator_tables_ready = true;
+}
+
+void Oscillator_init(Oscillator* oscillator, Waveform waveform, float frequency, int sample_rate) {
+    if (!oscillator) return;
+    Oscillator_initTables();
+    oscillator->table = oscillator_tables[waveform < WAVEFORM_COUNT ? waveform : WAVEFORM_SINE];
+    oscillator->phase = 0;
+    Oscillator_setFrequency(oscillator, frequency, sample_rate);
+}
+
+const char* Waveform_toString(Waveform waveform) {
+    switch (waveform) {
+        case WAVEFORM_SINE:
+            return "Sine";
+        case WAVEFORM_SQUARE:
+            return "Square";
+        case WAVEFORM_TRIANGLE:
+            return "Triangle";
+        default:
+            return "Unknown";
+    }
+}
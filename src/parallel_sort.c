@@ -0,0 +1,850 @@
+/*
+ * Copyright (c) 2025 Torisutan
+ * ALl rights reserved
+ */
+#include "parallel_sort.h"
+
+#include "column_graph.h"
+#include "logger.h"
+#include "random.h"
+#include "sort.h"
+#include "stats.h"
+#include "trace.h"
+#include "utils.h"
+#include "vector.h"
+
+static void ParallelSort_insertion(ParallelSortContext* context, GraphStats* stats, void** data, size_t start, size_t end);
+static void* ParallelSort_median(ParallelSortContext* context, GraphStats* stats, void* a, void* b, void* c);
+static void SampleSort_buildTree(SampleSort* job, void** splitters, size_t node, size_t low, size_t high);
+static int SampleSort_classify(void* data);
+static int SampleSort_scatter(void* data);
+static int SampleSort_sortBuckets(void* data);
+static bool WorkDeque_push(WorkDeque* deque, size_t start, size_t end);
+static bool WorkDeque_pop(WorkDeque* deque, size_t* start, size_t* end);
+static bool WorkDeque_steal(WorkDeque* deque, size_t* start, size_t* end);
+static int ParallelQuick_classify(void* data);
+static int ParallelQuick_scatter(void* data);
+static int ParallelQuick_copyBack(void* data);
+static int ParallelQuick_work(void* data);
+static void ParallelQuick_sortTask(ParallelSortWorker* worker, size_t start, size_t end);
+static int ParallelRadix_range(void* data);
+static int ParallelRadix_count(void* data);
+static int ParallelRadix_scatter(void* data);
+static int ParallelRadix_copyBack(void* data);
+
+int ParallelSort_threadCount(size_t size) {
+    int count = SDL_GetCPUCount();
+    if (count > PARALLEL_SORT_MAX_THREADS) {
+        count = PARALLEL_SORT_MAX_THREADS;
+    }
+    if ((size_t) count > size / PARALLEL_SORT_MIN_PER_THREAD) {
+        count = (int) (size / PARALLEL_SORT_MIN_PER_THREAD);
+    }
+    return count < 1 ? 1 : count;
+}
+
+void ParallelSort_initContext(ParallelSortContext* context, CompareFunc compare_func, SDL_mutex* gm, DelayFunc delay_func, MainFrame* mainframe, ColumnGraph* column_graph) {
+    context->compare_func = compare_func ? compare_func : Vector_defaultCompare;
+    context->gm = gm;
+    context->delay_func = delay_func;
+    context->mainframe = mainframe;
+    context->column_graph = column_graph;
+}
+
+static int ParallelSort_poolThread(void* data) {
+    ParallelSortWorker* worker = data;
+    ParallelSortPool* pool = worker->pool;
+    for (;;) {
+        SDL_SemWait(pool->wake[worker->index]);
+        SDL_ThreadFunction phase = pool->phase;
+        if (!phase) return 0;
+        // Named on every phase: a recording may have started since the previous one.
+        Trace_setThreadName("%s worker %d", pool->name, worker->index);
+        phase(worker);
+        SDL_SemPost(pool->done);
+    }
+}
+
+ParallelSortPool* ParallelSort_createPool(void* job, int count, const char* name) {
+    ParallelSortPool* pool = calloc(1, sizeof(ParallelSortPool));
+    if (!pool) {
+        error("Failed to allocate memory for a parallel sort pool");
+        return NULL;
+    }
+    pool->name = name;
+    pool->workers = calloc(count, sizeof(ParallelSortWorker));
+    pool->done = SDL_CreateSemaphore(0);
+    if (!pool->workers || !pool->done) {
+        error("Failed to create a parallel sort pool");
+        ParallelSort_destroyPool(pool);
+        return NULL;
+    }
+    for (int i = 0; i < count; i++) {
+        ParallelSortWorker* worker = &pool->workers[i];
+        worker->job = job;
+        worker->pool = pool;
+        worker->index = i;
+        worker->thread_count = count;
+        worker->stats = GraphStats_new();
+        if (!worker->stats) {
+            ParallelSort_destroyPool(pool);
+            return NULL;
+        }
+        pool->count = i + 1;
+    }
+    for (int i = 1; i < count; i++) {
+        pool->wake[i] = SDL_CreateSemaphore(0);
+        if (pool->wake[i]) {
+            pool->threads[i] = SDL_CreateThread(ParallelSort_poolThread, "SortWorker", &pool->workers[i]);
+        }
+        if (!pool->threads[i]) {
+            log_message(LOG_LEVEL_WARN, "Cannot start a sort worker thread, running it on the sorting thread: %s", SDL_GetError());
+        }
+    }
+    return pool;
+}
+
+void ParallelSort_destroyPool(ParallelSortPool* pool) {
+    if (!pool) return;
+    pool->phase = NULL;
+    for (int i = 1; i < pool->count; i++) {
+        if (pool->threads[i]) {
+            SDL_SemPost(pool->wake[i]);
+            SDL_WaitThread(pool->threads[i], NULL);
+        }
+        if (pool->wake[i]) {
+            SDL_DestroySemaphore(pool->wake[i]);
+        }
+    }
+    for (int i = 0; i < pool->count; i++) {
+        GraphStats_destroy(pool->workers[i].stats);
+    }
+    if (pool->done) {
+        SDL_DestroySemaphore(pool->done);
+    }
+    free(pool->workers);
+    free(pool);
+}
+
+void ParallelSort_run(ParallelSortPool* pool, SDL_ThreadFunction phase, GraphStats* stats) {
+    int started = 0;
+    pool->phase = phase;
+    for (int i = 1; i < pool->count; i++) {
+        if (pool->threads[i]) {
+            SDL_SemPost(pool->wake[i]);
+            started++;
+        }
+    }
+    phase(&pool->workers[0]);
+    for (int i = 1; i < pool->count; i++) {
+        if (!pool->threads[i]) {
+            phase(&pool->workers[i]);
+        }
+    }
+    while (started-- > 0) {
+        SDL_SemWait(pool->done);
+    }
+    for (int i = 0; i < pool->count; i++) {
+        GraphStats_merge(stats, pool->workers[i].stats);
+        GraphStats_reset(pool->workers[i].stats);
+    }
+}
+
+void ParallelSort_delay(ParallelSortContext* context, void* a, void* b) {
+    if (!context->delay_func) return;
+    context->delay_func(context->mainframe, context->column_graph, a, b);
+}
+
+void ParallelSort_swap(ParallelSortContext* context, GraphStats* stats, void** data, size_t i, size_t j) {
+    if (i == j) return;
+    void* a = data[i];
+    void* b = data[j];
+    if (context->gm) SDL_LockMutex(context->gm);
+    data[i] = b;
+    data[j] = a;
+    if (context->gm) SDL_UnlockMutex(context->gm);
+    GraphStats_incrementSwaps(stats);
+    GraphStats_incrementReads(stats, 1);
+    GraphStats_incrementWrites(stats, 2);
+    ParallelSort_delay(context, a, b);
+}
+
+static void ParallelSort_insertion(ParallelSortContext* context, GraphStats* stats, void** data, size_t start, size_t end) {
+    for (size_t i = start + 1; i < end; i++) {
+        void* key = data[i];
+        size_t j = i;
+        while (j > start) {
+            GraphStats_incrementComparisons(stats);
+            GraphStats_incrementReads(stats, 2);
+            if (context->compare_func(data[j - 1], key) <= 0) break;
+            if (context->gm) SDL_LockMutex(context->gm);
+            data[j] = data[j - 1];
+            if (context->gm) SDL_UnlockMutex(context->gm);
+            GraphStats_incrementSwaps(stats);
+            GraphStats_incrementWrites(stats, 1);
+            ParallelSort_delay(context, data[j], key);
+            j--;
+        }
+        if (j == i) continue;
+        if (context->gm) SDL_LockMutex(context->gm);
+        data[j] = key;
+        if (context->gm) SDL_UnlockMutex(context->gm);
+        GraphStats_incrementWrites(stats, 1);
+        ParallelSort_delay(context, key, NULL);
+    }
+}
+
+static void* ParallelSort_median(ParallelSortContext* context, GraphStats* stats, void* a, void* b, void* c) {
+    CompareFunc compare = context->compare_func;
+    GraphStats_incrementComparisons(stats);
+    GraphStats_incrementComparisons(stats);
+    GraphStats_incrementReads(stats, 3);
+    if (compare(a, b) < 0) {
+        if (compare(b, c) < 0) return b;
+        GraphStats_incrementComparisons(stats);
+        return compare(a, c) < 0 ? c : a;
+    }
+    if (compare(a, c) < 0) return a;
+    GraphStats_incrementComparisons(stats);
+    return compare(b, c) < 0 ? c : b;
+}
+
+void ParallelSort_partition(ParallelSortContext* context, GraphStats* stats, void** data, size_t start, size_t end, void* pivot, size_t* lt, size_t* gt) {
+    size_t low = start;
+    size_t i = start;
+    size_t high = end;
+    while (i < high) {
+        GraphStats_incrementComparisons(stats);
+        GraphStats_incrementReads(stats, 1);
+        int order = context->compare_func(data[i], pivot);
+        if (order < 0) {
+            ParallelSort_swap(context, stats, data, low++, i++);
+        } else if (order > 0) {
+            ParallelSort_swap(context, stats, data, i, --high);
+        } else {
+            i++;
+        }
+    }
+    *lt = low;
+    *gt = high;
+}
+
+void ParallelSort_sortRange(ParallelSortContext* context, GraphStats* stats, void** data, size_t start, size_t end) {
+    while (end - start >= PARALLEL_SORT_INSERTION_THRESHOLD) {
+        void* pivot = ParallelSort_median(context, stats, data[start], data[start + (end - start) / 2], data[end - 1]);
+        size_t lt;
+        size_t gt;
+        ParallelSort_partition(context, stats, data, start, end, pivot, &lt, &gt);
+        if (lt - start < end - gt) {
+            ParallelSort_sortRange(context, stats, data, start, lt);
+            start = gt;
+        } else {
+            ParallelSort_sortRange(context, stats, data, gt, end);
+            end = lt;
+        }
+    }
+    ParallelSort_insertion(context, stats, data, start, end);
+}
+
+// Fills the subtree of node with the sorted splitters [low, high), the middle one at the node.
+static void SampleSort_buildTree(SampleSort* job, void** splitters, size_t node, size_t low, size_t high) {
+    if (node >= (size_t) job->bucket_count || low >= high) return;
+    size_t middle = low + (high - low) / 2;
+    job->tree[node] = splitters[middle];
+    SampleSort_buildTree(job, splitters, 2 * node, low, middle);
+    SampleSort_buildTree(job, splitters, 2 * node + 1, middle + 1, high);
+}
+
+static int SampleSort_classify(void* data) {
+    ParallelSortWorker* worker = data;
+    SampleSort* job = worker->job;
+    size_t start = job->size * worker->index / worker->thread_count;
+    size_t end = job->size * (worker->index + 1) / worker->thread_count;
+    size_t* counts = job->offsets + (size_t) worker->index * job->bucket_count;
+    CompareFunc compare = job->context.compare_func;
+    for (size_t i = start; i < end; i++) {
+        void* element = job->data[i];
+        // Each level adds the comparison result to the index instead of branching on it.
+        size_t node = 1;
+        for (int level = 0; level < job->levels; level++) {
+            node = 2 * node + (compare(job->tree[node], element) < 0);
+        }
+        size_t bucket = node - job->bucket_count;
+        job->oracle[i] = (Uint8) bucket;
+        counts[bucket]++;
+    }
+    if (worker->stats) {
+        worker->stats->comparisons += (int) ((end - start) * job->levels);
+    }
+    GraphStats_incrementReads(worker->stats, (int) ((end - start) * (job->levels + 1)));
+    GraphStats_incrementWrites(worker->stats, (int) (2 * (end - start)));
+    return 0;
+}
+
+static int SampleSort_scatter(void* data) {
+    ParallelSortWorker* worker = data;
+    SampleSort* job = worker->job;
+    size_t start = job->size * worker->index / worker->thread_count;
+    size_t end = job->size * (worker->index + 1) / worker->thread_count;
+    size_t* offsets = job->offsets + (size_t) worker->index * job->bucket_count;
+    for (size_t i = start; i < end; i++) {
+        job->output[offsets[job->oracle[i]]++] = job->data[i];
+    }
+    GraphStats_incrementReads(worker->stats, (int) (2 * (end - start)));
+    GraphStats_incrementWrites(worker->stats, (int) (2 * (end - start)));
+    return 0;
+}
+
+static int SampleSort_sortBuckets(void* data) {
+    ParallelSortWorker* worker = data;
+    SampleSort* job = worker->job;
+    ParallelSortContext* context = &job->context;
+    int bucket;
+    while ((bucket = SDL_AtomicAdd(&job->next_bucket, 1)) < job->bucket_count) {
+        size_t start = job->bucket_starts[bucket];
+        size_t end = job->bucket_starts[bucket + 1];
+        for (size_t i = start; i < end; i++) {
+            if (context->gm) SDL_LockMutex(context->gm);
+            job->data[i] = job->output[i];
+            if (context->gm) SDL_UnlockMutex(context->gm);
+            ParallelSort_delay(context, job->data[i], NULL);
+        }
+        GraphStats_incrementReads(worker->stats, (int) (end - start));
+        GraphStats_incrementWrites(worker->stats, (int) (end - start));
+        ParallelSort_sortRange(context, worker->stats, job->data, start, end);
+    }
+    return 0;
+}
+
+void Vector_sortSample(Vector* list, CompareFunc compare_func, SDL_mutex* gm, DelayFunc delay_func, MainFrame* mainframe, ColumnGraph* column_graph) {
+    if (!list || list->size < 2) return;
+
+    GraphStats* stats = column_graph ? column_graph->stats : NULL;
+    SampleSort* job = calloc(1, sizeof(SampleSort));
+    if (!job) {
+        error("Failed to allocate memory for sample sort");
+        return;
+    }
+    ParallelSort_initContext(&job->context, compare_func, gm, delay_func, mainframe, column_graph);
+    job->data = list->data;
+    job->size = list->size;
+
+    int thread_count = ParallelSort_threadCount(job->size);
+    if (thread_count < 2) {
+        ParallelSort_sortRange(&job->context, stats, job->data, 0, job->size);
+        free(job);
+        return;
+    }
+
+    job->bucket_count = 2;
+    while (job->bucket_count < thread_count * SORT_SAMPLE_BUCKETS_PER_THREAD
+           && job->bucket_count < SORT_SAMPLE_MAX_BUCKETS
+           && (size_t) job->bucket_count * 2 * SORT_SAMPLE_OVERSAMPLING <= job->size) {
+        job->bucket_count *= 2;
+    }
+    for (int b = job->bucket_count; b > 1; b /= 2) {
+        job->levels++;
+    }
+
+    size_t sample_count = (size_t) job->bucket_count * SORT_SAMPLE_OVERSAMPLING;
+    size_t aux_bytes = sizeof(SampleSort) + sample_count * sizeof(void*) + job->size * (sizeof(void*) + sizeof(Uint8))
+                       + (size_t) thread_count * job->bucket_count * sizeof(size_t);
+    void** samples = malloc(sample_count * sizeof(void*));
+    job->output = malloc(job->size * sizeof(void*));
+    job->oracle = malloc(job->size);
+    job->offsets = calloc((size_t) thread_count * job->bucket_count, sizeof(size_t));
+    ParallelSortPool* pool = ParallelSort_createPool(job, thread_count, "Sample sort");
+    PRNG* prng = PRNG_init((Uint32) job->size);
+    if (!samples || !job->output || !job->oracle || !job->offsets || !pool || !prng) {
+        error("Failed to allocate memory for sample sort");
+        free(samples);
+        free(job->output);
+        free(job->oracle);
+        free(job->offsets);
+        ParallelSort_destroyPool(pool);
+        PRNG_destroy(prng);
+        free(job);
+        return;
+    }
+    GraphStats_allocAux(stats, aux_bytes);
+
+    // The samples are a private copy: sorting them is neither locked nor shown.
+    for (size_t i = 0; i < sample_count; i++) {
+        samples[i] = job->data[PRNG_next(prng) % job->size];
+    }
+    PRNG_destroy(prng);
+    GraphStats_incrementReads(stats, (int) sample_count);
+    ParallelSortContext private_context = { .compare_func = job->context.compare_func };
+    ParallelSort_sortRange(&private_context, stats, samples, 0, sample_count);
+    for (int b = 0; b + 1 < job->bucket_count; b++) {
+        samples[b] = samples[(size_t) (b + 1) * SORT_SAMPLE_OVERSAMPLING - 1];
+    }
+    SampleSort_buildTree(job, samples, 1, 0, (size_t) job->bucket_count - 1);
+    free(samples);
+
+    ParallelSort_run(pool, SampleSort_classify, stats);
+
+    // Bucket b starts after all smaller buckets, and each thread after the previous threads in it.
+    size_t offset = 0;
+    for (int b = 0; b < job->bucket_count; b++) {
+        job->bucket_starts[b] = offset;
+        for (int t = 0; t < thread_count; t++) {
+            size_t* count = &job->offsets[(size_t) t * job->bucket_count + b];
+            size_t bucket_size = *count;
+            *count = offset;
+            offset += bucket_size;
+        }
+    }
+    job->bucket_starts[job->bucket_count] = offset;
+
+    ParallelSort_run(pool, SampleSort_scatter, stats);
+    SDL_AtomicSet(&job->next_bucket, 0);
+    ParallelSort_run(pool, SampleSort_sortBuckets, stats);
+
+    log_message(LOG_LEVEL_DEBUG, "Sample sort of %zu elements on %d threads with %d buckets",
+                job->size, thread_count, job->bucket_count);
+
+    ParallelSort_destroyPool(pool);
+    free(job->output);
+    free(job->oracle);
+    free(job->offsets);
+    free(job);
+    GraphStats_freeAux(stats, aux_bytes);
+}
+
+static bool WorkDeque_push(WorkDeque* deque, size_t start, size_t end) {
+    SDL_AtomicLock(&deque->lock);
+    bool pushed = deque->bottom - deque->top < PARALLEL_QUICK_DEQUE_SIZE;
+    if (pushed) {
+        deque->starts[deque->bottom % PARALLEL_QUICK_DEQUE_SIZE] = start;
+        deque->ends[deque->bottom % PARALLEL_QUICK_DEQUE_SIZE] = end;
+        deque->bottom++;
+    }
+    SDL_AtomicUnlock(&deque->lock);
+    return pushed;
+}
+
+static bool WorkDeque_pop(WorkDeque* deque, size_t* start, size_t* end) {
+    SDL_AtomicLock(&deque->lock);
+    bool popped = deque->bottom > deque->top;
+    if (popped) {
+        deque->bottom--;
+        *start = deque->starts[deque->bottom % PARALLEL_QUICK_DEQUE_SIZE];
+        *end = deque->ends[deque->bottom % PARALLEL_QUICK_DEQUE_SIZE];
+    }
+    SDL_AtomicUnlock(&deque->lock);
+    return popped;
+}
+
+static bool WorkDeque_steal(WorkDeque* deque, size_t* start, size_t* end) {
+    SDL_AtomicLock(&deque->lock);
+    bool stolen = deque->bottom > deque->top;
+    if (stolen) {
+        *start = deque->starts[deque->top % PARALLEL_QUICK_DEQUE_SIZE];
+        *end = deque->ends[deque->top % PARALLEL_QUICK_DEQUE_SIZE];
+        deque->top++;
+    }
+    SDL_AtomicUnlock(&deque->lock);
+    return stolen;
+}
+
+static int ParallelQuick_classify(void* data) {
+    ParallelSortWorker* worker = data;
+    ParallelQuickSort* job = worker->job;
+    size_t length = job->end - job->start;
+    size_t start = job->start + length * worker->index / worker->thread_count;
+    size_t end = job->start + length * (worker->index + 1) / worker->thread_count;
+    size_t* counts = &job->counts[worker->index * 3];
+    counts[0] = counts[1] = counts[2] = 0;
+    for (size_t i = start; i < end; i++) {
+        int order = job->context.compare_func(job->data[i], job->pivot);
+        Uint8 class = (Uint8) ((order > 0) - (order < 0) + 1);
+        job->oracle[i] = class;
+        counts[class]++;
+    }
+    if (worker->stats) {
+        worker->stats->comparisons += (int) (end - start);
+    }
+    GraphStats_incrementReads(worker->stats, (int) (end - start));
+    GraphStats_incrementWrites(worker->stats, (int) (2 * (end - start)));
+    return 0;
+}
+
+static int ParallelQuick_scatter(void* data) {
+    ParallelSortWorker* worker = data;
+    ParallelQuickSort* job = worker->job;
+    size_t length = job->end - job->start;
+    size_t start = job->start + length * worker->index / worker->thread_count;
+    size_t end = job->start + length * (worker->index + 1) / worker->thread_count;
+    size_t* offsets = &job->counts[worker->index * 3];
+    for (size_t i = start; i < end; i++) {
+        job->buffer[offsets[job->oracle[i]]++] = job->data[i];
+    }
+    GraphStats_incrementReads(worker->stats, (int) (2 * (end - start)));
+    GraphStats_incrementWrites(worker->stats, (int) (2 * (end - start)));
+    return 0;
+}
+
+static int ParallelQuick_copyBack(void* data) {
+    ParallelSortWorker* worker = data;
+    ParallelQuickSort* job = worker->job;
+    ParallelSortContext* context = &job->context;
+    size_t length = job->end - job->start;
+    size_t start = job->start + length * worker->index / worker->thread_count;
+    size_t end = job->start + length * (worker->index + 1) / worker->thread_count;
+    for (size_t i = start; i < end; i++) {
+        if (context->gm) SDL_LockMutex(context->gm);
+        job->data[i] = job->buffer[i];
+        if (context->gm) SDL_UnlockMutex(context->gm);
+        ParallelSort_delay(context, job->data[i], NULL);
+    }
+    GraphStats_incrementReads(worker->stats, (int) (end - start));
+    GraphStats_incrementWrites(worker->stats, (int) (end - start));
+    return 0;
+}
+
+// Partitions a range, keeps one side and pushes the other for idle threads to steal.
+static void ParallelQuick_sortTask(ParallelSortWorker* worker, size_t start, size_t end) {
+    ParallelQuickSort* job = worker->job;
+    ParallelSortContext* context = &job->context;
+    WorkDeque* deque = &job->deques[worker->index];
+    while (end - start > PARALLEL_QUICK_GRAIN) {
+        void* pivot = ParallelSort_median(context, worker->stats, job->data[start],
+                                          job->data[start + (end - start) / 2], job->data[end - 1]);
+        size_t lt;
+        size_t gt;
+        ParallelSort_partition(context, worker->stats, job->data, start, end, pivot, &lt, &gt);
+        // The larger side is pushed: a thief taking it gets as much work as possible.
+        size_t push_start = start;
+        size_t push_end = lt;
+        if (lt - start < end - gt) {
+            push_start = gt;
+            push_end = end;
+            end = lt;
+        } else {
+            start = gt;
+        }
+        if (push_end - push_start < 2) continue;
+        SDL_AtomicAdd(&job->pending, 1);
+        if (!WorkDeque_push(deque, push_start, push_end)) {
+            SDL_AtomicAdd(&job->pending, -1);
+            ParallelSort_sortRange(context, worker->stats, job->data, push_start, push_end);
+        }
+    }
+    ParallelSort_sortRange(context, worker->stats, job->data, start, end);
+}
+
+static int ParallelQuick_work(void* data) {
+    ParallelSortWorker* worker = data;
+    ParallelQuickSort* job = worker->job;
+    size_t start;
+    size_t end;
+    while (true) {
+        bool found = WorkDeque_pop(&job->deques[worker->index], &start, &end);
+        for (int i = 1; !found && i < worker->thread_count; i++) {
+            found = WorkDeque_steal(&job->deques[(worker->index + i) % worker->thread_count], &start, &end);
+        }
+        if (!found) {
+            if (SDL_AtomicGet(&job->pending) == 0) break;
+            SDL_Delay(0);
+            continue;
+        }
+        ParallelQuick_sortTask(worker, start, end);
+        SDL_AtomicAdd(&job->pending, -1);
+    }
+    return 0;
+}
+
+void Vector_sortParallelQuick(Vector* list, CompareFunc compare_func, SDL_mutex* gm, DelayFunc delay_func, MainFrame* mainframe, ColumnGraph* column_graph) {
+    if (!list || list->size < 2) return;
+
+    GraphStats* stats = column_graph ? column_graph->stats : NULL;
+    ParallelQuickSort* job = calloc(1, sizeof(ParallelQuickSort));
+    if (!job) {
+        error("Failed to allocate memory for parallel quick sort");
+        return;
+    }
+    ParallelSort_initContext(&job->context, compare_func, gm, delay_func, mainframe, column_graph);
+    job->data = list->data;
+    job->size = list->size;
+
+    int thread_count = ParallelSort_threadCount(job->size);
+    if (thread_count < 2) {
+        ParallelSort_sortRange(&job->context, stats, job->data, 0, job->size);
+        free(job);
+        return;
+    }
+
+    size_t aux_bytes = sizeof(ParallelQuickSort) + job->size * (sizeof(void*) + sizeof(Uint8))
+                       + (size_t) thread_count * sizeof(WorkDeque);
+    job->buffer = malloc(job->size * sizeof(void*));
+    job->oracle = malloc(job->size);
+    job->deques = calloc(thread_count, sizeof(WorkDeque));
+    ParallelSortPool* pool = ParallelSort_createPool(job, thread_count, "Quick sort");
+    if (!job->buffer || !job->oracle || !job->deques || !pool) {
+        error("Failed to allocate memory for parallel quick sort");
+        free(job->buffer);
+        free(job->oracle);
+        free(job->deques);
+        ParallelSort_destroyPool(pool);
+        free(job);
+        return;
+    }
+    GraphStats_allocAux(stats, aux_bytes);
+
+    // Top levels: the largest range is partitioned by all threads until each one has a range.
+    size_t starts[PARALLEL_SORT_MAX_THREADS + 1] = { 0 };
+    size_t ends[PARALLEL_SORT_MAX_THREADS + 1] = { job->size };
+    int range_count = 1;
+    while (range_count > 0 && range_count < thread_count) {
+        int largest = 0;
+        for (int i = 1; i < range_count; i++) {
+            if (ends[i] - starts[i] > ends[largest] - starts[largest]) {
+                largest = i;
+            }
+        }
+        job->start = starts[largest];
+        job->end = ends[largest];
+        if (job->end - job->start < (size_t) thread_count * PARALLEL_SORT_MIN_PER_THREAD) break;
+
+        job->pivot = ParallelSort_median(&job->context, stats, job->data[job->start],
+                                         job->data[job->start + (job->end - job->start) / 2], job->data[job->end - 1]);
+        ParallelSort_run(pool, ParallelQuick_classify, stats);
+        size_t offset = job->start;
+        for (int c = 0; c < 3; c++) {
+            for (int t = 0; t < thread_count; t++) {
+                size_t count = job->counts[t * 3 + c];
+                job->counts[t * 3 + c] = offset;
+                offset += count;
+            }
+        }
+        // Scatter positions of thread 0 for the equal and greater elements are where those parts start.
+        size_t lt = job->counts[1];
+        size_t gt = job->counts[2];
+        ParallelSort_run(pool, ParallelQuick_scatter, stats);
+        ParallelSort_run(pool, ParallelQuick_copyBack, stats);
+
+        starts[largest] = starts[--range_count];
+        ends[largest] = ends[range_count];
+        if (lt - job->start > 1) {
+            starts[range_count] = job->start;
+            ends[range_count++] = lt;
+        }
+        if (job->end - gt > 1) {
+            starts[range_count] = gt;
+            ends[range_count++] = job->end;
+        }
+    }
+
+    for (int i = 0; i < range_count; i++) {
+        WorkDeque_push(&job->deques[i % thread_count], starts[i], ends[i]);
+    }
+    SDL_AtomicSet(&job->pending, range_count);
+    ParallelSort_run(pool, ParallelQuick_work, stats);
+
+    log_message(LOG_LEVEL_DEBUG, "Parallel quick sort of %zu elements on %d threads", job->size, thread_count);
+
+    ParallelSort_destroyPool(pool);
+    free(job->buffer);
+    free(job->oracle);
+    free(job->deques);
+    free(job);
+    GraphStats_freeAux(stats, aux_bytes);
+}
+
+static int ParallelRadix_range(void* data) {
+    ParallelSortWorker* worker = data;
+    ParallelRadixSort* job = worker->job;
+    size_t start = job->size * worker->index / worker->thread_count;
+    size_t end = job->size * (worker->index + 1) / worker->thread_count;
+    long min = (long) ((ColumnGraphBar*) job->data[start])->value;
+    long max = min;
+    for (size_t i = start + 1; i < end; i++) {
+        long value = (long) ((ColumnGraphBar*) job->data[i])->value;
+        if (value < min) min = value;
+        if (value > max) max = value;
+    }
+    job->mins[worker->index] = min;
+    job->maxs[worker->index] = max;
+    GraphStats_incrementReads(worker->stats, (int) (end - start));
+    return 0;
+}
+
+static int ParallelRadix_count(void* data) {
+    ParallelSortWorker* worker = data;
+    ParallelRadixSort* job = worker->job;
+    size_t start = job->size * worker->index / worker->thread_count;
+    size_t end = job->size * (worker->index + 1) / worker->thread_count;
+    size_t* counts = job->counts + (size_t) worker->index * PARALLEL_RADIX_BUCKETS;
+    memset(counts, 0, PARALLEL_RADIX_BUCKETS * sizeof(size_t));
+    for (size_t i = start; i < end; i++) {
+        unsigned long key = (unsigned long) (long) ((ColumnGraphBar*) job->source[i])->value - (unsigned long) job->min;
+        counts[(key >> job->shift) & (PARALLEL_RADIX_BUCKETS - 1)]++;
+    }
+    GraphStats_incrementReads(worker->stats, (int) (end - start));
+    GraphStats_incrementWrites(worker->stats, (int) (end - start));
+    return 0;
+}
+
+static int ParallelRadix_scatter(void* data) {
+    ParallelSortWorker* worker = data;
+    ParallelRadixSort* job = worker->job;
+    size_t start = job->size * worker->index / worker->thread_count;
+    size_t end = job->size * (worker->index + 1) / worker->thread_count;
+    size_t* offsets = job->counts + (size_t) worker->index * PARALLEL_RADIX_BUCKETS;
+    void** combine = job->combine + (size_t) worker->index * PARALLEL_RADIX_BUCKETS * PARALLEL_RADIX_COMBINE;
+    Uint8* fill = job->fill + (size_t) worker->index * PARALLEL_RADIX_BUCKETS;
+    memset(fill, 0, PARALLEL_RADIX_BUCKETS);
+    for (size_t i = start; i < end; i++) {
+        void* element = job->source[i];
+        unsigned long key = (unsigned long) (long) ((ColumnGraphBar*) element)->value - (unsigned long) job->min;
+        size_t bucket = (key >> job->shift) & (PARALLEL_RADIX_BUCKETS - 1);
+        void** line = combine + bucket * PARALLEL_RADIX_COMBINE;
+        line[fill[bucket]++] = element;
+        // A line is written out once it ends on a cache line of the target, instead of one scattered
+        // store per element. Only the first flush of a bucket can be shorter, the next ones are aligned.
+        void** flush_end = job->target + offsets[bucket] + fill[bucket];
+        if ((uintptr_t) flush_end % PARALLEL_SORT_CACHE_LINE == 0) {
+            memcpy(job->target + offsets[bucket], line, fill[bucket] * sizeof(void*));
+            offsets[bucket] += fill[bucket];
+            fill[bucket] = 0;
+        }
+    }
+    for (size_t bucket = 0; bucket < PARALLEL_RADIX_BUCKETS; bucket++) {
+        memcpy(job->target + offsets[bucket], combine + bucket * PARALLEL_RADIX_COMBINE, fill[bucket] * sizeof(void*));
+        offsets[bucket] += fill[bucket];
+    }
+    GraphStats_incrementReads(worker->stats, (int) (end - start));
+    GraphStats_incrementWrites(worker->stats, (int) (2 * (end - start)));
+    return 0;
+}
+
+static int ParallelRadix_copyBack(void* data) {
+    ParallelSortWorker* worker = data;
+    ParallelRadixSort* job = worker->job;
+    ParallelSortContext* context = &job->context;
+    size_t start = job->size * worker->index / worker->thread_count;
+    size_t end = job->size * (worker->index + 1) / worker->thread_count;
+    if (!job->visible) {
+        if (context->gm) SDL_LockMutex(context->gm);
+        memcpy(job->data + start, job->source + start, (end - start) * sizeof(void*));
+        if (context->gm) SDL_UnlockMutex(context->gm);
+    } else {
+        for (size_t i = start; i < end; i++) {
+            if (context->gm) SDL_LockMutex(context->gm);
+            job->data[i] = job->source[i];
+            if (context->gm) SDL_UnlockMutex(context->gm);
+            ParallelSort_delay(context, job->data[i], NULL);
+        }
+    }
+    GraphStats_incrementReads(worker->stats, (int) (end - start));
+    GraphStats_incrementWrites(worker->stats, (int) (end - start));
+    return 0;
+}
+
+void Vector_sortParallelRadix(Vector* list, CompareFunc compare_func, SDL_mutex* gm, DelayFunc delay_func, MainFrame* mainframe, ColumnGraph* column_graph) {
+    if (column_graph && column_graph->type != GRAPH_TYPE_INT) {
+        log_message(LOG_LEVEL_WARN, "Parallel radix sort only supports integer lists.");
+        return;
+    }
+    if (!list || list->size < 2) return;
+
+    GraphStats* stats = column_graph ? column_graph->stats : NULL;
+    ParallelRadixSort* job = calloc(1, sizeof(ParallelRadixSort));
+    if (!job) {
+        error("Failed to allocate memory for parallel radix sort");
+        return;
+    }
+    ParallelSort_initContext(&job->context, compare_func, gm, delay_func, mainframe, column_graph);
+    job->data = list->data;
+    job->size = list->size;
+    job->visible = delay_func != NULL;
+
+    // Small lists still go through the same passes, on a single thread.
+    int thread_count = ParallelSort_threadCount(job->size);
+    size_t aux_bytes = sizeof(ParallelRadixSort) + job->size * sizeof(void*)
+                       + (size_t) thread_count * PARALLEL_RADIX_BUCKETS
+                         * (sizeof(size_t) + PARALLEL_RADIX_COMBINE * sizeof(void*) + sizeof(Uint8))
+                       + PARALLEL_SORT_CACHE_LINE;
+    void** buffer = malloc(job->size * sizeof(void*));
+    job->counts = malloc((size_t) thread_count * PARALLEL_RADIX_BUCKETS * sizeof(size_t));
+    // Over-allocated by a cache line to align the lines by hand, aligned_alloc is missing on Windows.
+    job->combine_memory = malloc((size_t) thread_count * PARALLEL_RADIX_BUCKETS * PARALLEL_RADIX_COMBINE * sizeof(void*)
+                                 + PARALLEL_SORT_CACHE_LINE);
+    job->combine = (void**) (((uintptr_t) job->combine_memory + PARALLEL_SORT_CACHE_LINE - 1)
+                             & ~(uintptr_t) (PARALLEL_SORT_CACHE_LINE - 1));
+    job->fill = malloc((size_t) thread_count * PARALLEL_RADIX_BUCKETS);
+    ParallelSortPool* pool = ParallelSort_createPool(job, thread_count, "Radix sort");
+    if (!buffer || !job->counts || !job->combine_memory || !job->fill || !pool) {
+        error("Failed to allocate memory for parallel radix sort");
+        free(buffer);
+        free(job->counts);
+        free(job->combine_memory);
+        free(job->fill);
+        ParallelSort_destroyPool(pool);
+        free(job);
+        return;
+    }
+    GraphStats_allocAux(stats, aux_bytes);
+
+    ParallelSort_run(pool, ParallelRadix_range, stats);
+    job->min = job->mins[0];
+    long max = job->maxs[0];
+    for (int t = 1; t < thread_count; t++) {
+        if (job->mins[t] < job->min) job->min = job->mins[t];
+        if (job->maxs[t] > max) max = job->maxs[t];
+    }
+    unsigned long range = (unsigned long) max - (unsigned long) job->min;
+
+    job->source = job->data;
+    job->target = buffer;
+    int passes = 0;
+    for (job->shift = 0; job->shift < (int) sizeof(unsigned long) * 8 && (range >> job->shift) > 0;
+         job->shift += PARALLEL_RADIX_BITS) {
+        ParallelSort_run(pool, ParallelRadix_count, stats);
+        // Bucket b goes after all smaller buckets, and each thread after the previous threads in it.
+        size_t offset = 0;
+        bool single_bucket = false;
+        for (size_t b = 0; b < PARALLEL_RADIX_BUCKETS; b++) {
+            size_t bucket_start = offset;
+            for (int t = 0; t < thread_count; t++) {
+                size_t* count = &job->counts[(size_t) t * PARALLEL_RADIX_BUCKETS + b];
+                size_t bucket_size = *count;
+                *count = offset;
+                offset += bucket_size;
+            }
+            single_bucket = single_bucket || offset - bucket_start == job->size;
+        }
+        // Every key has the same digit, the pass would not move anything.
+        if (single_bucket) continue;
+
+        // Passes ping-ponging back into the list write it while the graph may be drawn, hold the graph mutex over them.
+        bool into_list = job->target == job->data;
+        if (into_list && gm) SDL_LockMutex(gm);
+        ParallelSort_run(pool, ParallelRadix_scatter, stats);
+        if (into_list && gm) SDL_UnlockMutex(gm);
+        passes++;
+        void** sorted = job->target;
+        job->target = job->source;
+        job->source = sorted;
+        if (job->visible) {
+            ParallelSort_run(pool, ParallelRadix_copyBack, stats);
+            job->target = buffer;
+            job->source = job->data;
+        }
+    }
+    if (job->source != job->data) {
+        ParallelSort_run(pool, ParallelRadix_copyBack, stats);
+    }
+
+    log_message(LOG_LEVEL_DEBUG, "Parallel radix sort of %zu elements on %d threads in %d passes",
+                job->size, thread_count, passes);
+
+    ParallelSort_destroyPool(pool);
+    free(buffer);
+    free(job->counts);
+    free(job->combine_memory);
+    free(job->fill);
+    free(job);
+    GraphStats_freeAux(stats, aux_bytes);
+}
@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2025 Torisutan
+ * ALl rights reserved
+ */
+#include "pool.h"
+#include "logger.h"
+#include "utils.h"
+
+static bool Pool_grow(Pool* pool);
+static void Pool_freeSlots(Pool* pool, char* chunk);
+
+Pool* Pool_create(size_t object_size, size_t chunk_capacity) {
+    Pool* pool = calloc(1, sizeof(Pool));
+    if (!pool) {
+        error("Failed to allocate memory for Pool");
+        return NULL;
+    }
+    pool->object_size = object_size > sizeof(void*) ? object_size : sizeof(void*);
+    pool->chunk_capacity = chunk_capacity ? chunk_capacity : 1;
+    return pool;
+}
+
+void Pool_destroy(Pool* pool) {
+    if (!pool) return;
+    Pool_release(pool);
+    safe_free((void**)&pool);
+}
+
+static void Pool_freeSlots(Pool* pool, char* chunk) {
+    for (size_t i = pool->chunk_capacity; i > 0; i--) {
+        void* slot = chunk + i * pool->object_size;
+        *(void**) slot = pool->free_list;
+        pool->free_list = slot;
+    }
+}
+
+static bool Pool_grow(Pool* pool) {
+    // The first slot of every chunk links the chunks together, the others go to the free list.
+    char* chunk = malloc((pool->chunk_capacity + 1) * pool->object_size);
+    if (!chunk) {
+        error("Failed to allocate memory for Pool chunk");
+        return false;
+    }
+    *(void**) chunk = pool->chunks;
+    pool->chunks = chunk;
+    Pool_freeSlots(pool, chunk);
+    return true;
+}
+
+void* Pool_alloc(Pool* pool) {
+    SDL_AtomicLock(&pool->lock);
+    if (!pool->free_list && !Pool_grow(pool)) {
+        SDL_AtomicUnlock(&pool->lock);
+        return NULL;
+    }
+    void* slot = pool->free_list;
+    pool->free_list = *(void**) slot;
+    pool->in_use++;
+    SDL_AtomicUnlock(&pool->lock);
+    memset(slot, 0, pool->object_size);
+    return slot;
+}
+
+void Pool_free(Pool* pool, void* ptr) {
+    if (!ptr) return;
+    SDL_AtomicLock(&pool->lock);
+    *(void**) ptr = pool->free_list;
+    pool->free_list = ptr;
+    pool->in_use--;
+    SDL_AtomicUnlock(&pool->lock);
+}
+
+void Pool_clear(Pool* pool) {
+    SDL_AtomicLock(&pool->lock);
+    pool->free_list = NULL;
+    for (char* chunk = pool->chunks; chunk; chunk = *(char**) chunk) {
+        Pool_freeSlots(pool, chunk);
+    }
+    pool->in_use = 0;
+    SDL_AtomicUnlock(&pool->lock);
+}
+
+void Pool_release(Pool* pool) {
+    SDL_AtomicLock(&pool->lock);
+    void* chunk = pool->chunks;
+    while (chunk) {
+        void* next = *(void**) chunk;
+        free(chunk);
+        chunk = next;
+    }
+    pool->chunks = NULL;
+    pool->free_list = NULL;
+    pool->in_use = 0;
+    SDL_AtomicUnlock(&pool->lock);
+}
@@ -0,0 +1,217 @@
+/*
+ * Copyright (c) 2025 Torisutan
+ * ALl rights reserved
+ */
+#include "profiler.h"
+
+#include "app.h"
+#include "color.h"
+#include "geometry.h"
+#include "logger.h"
+#include "resource_manager.h"
+#include "style.h"
+#include "text.h"
+#include "utils.h"
+
+#define PROFILER_LINE_COUNT (PROFILER_PHASE_COUNT + 2)
+
+static int Profiler_compareFloat(const void* a, const void* b);
+static void Profiler_refresh(Profiler* profiler);
+static void Profiler_updateLines(Profiler* profiler);
+
+Profiler* Profiler_create() {
+    Profiler* profiler = calloc(1, sizeof(Profiler));
+    if (!profiler) {
+        error("Failed to allocate memory for Profiler");
+        return NULL;
+    }
+    profiler->frame_start = SDL_GetPerformanceCounter();
+    profiler->last_refresh = SDL_GetTicks64();
+    return profiler;
+}
+
+void Profiler_destroy(Profiler* profiler) {
+    if (!profiler) return;
+    for (int i = 0; i < PROFILER_LINE_COUNT; i++) {
+        Text_destroy(profiler->lines[i]);
+    }
+    safe_free((void**)&profiler);
+}
+
+Uint64 Profiler_begin() {
+    return SDL_GetPerformanceCounter();
+}
+
+void Profiler_end(Profiler* profiler, ProfilerPhase phase, Uint64 start) {
+    if (!profiler || phase >= PROFILER_PHASE_COUNT) return;
+    Uint64 elapsed = SDL_GetPerformanceCounter() - start;
+    profiler->current[phase] += (float) ((double) elapsed * 1000.0 / (double) SDL_GetPerformanceFrequency());
+}
+
+void Profiler_endFrame(Profiler* profiler) {
+    if (!profiler) return;
+    Uint64 now = SDL_GetPerformanceCounter();
+    profiler->current[PROFILER_PHASE_FRAME] =
+        (float) ((double) (now - profiler->frame_start) * 1000.0 / (double) SDL_GetPerformanceFrequency());
+    profiler->frame_start = now;
+
+    if (profiler->current[PROFILER_PHASE_FRAME] > PROFILER_DROP_FACTOR * 1000.f / FRAME_RATE) {
+        profiler->dropped_total++;
+    }
+    for (int phase = 0; phase < PROFILER_PHASE_COUNT; phase++) {
+        profiler->samples[phase][profiler->head] = profiler->current[phase];
+        profiler->current[phase] = 0;
+    }
+    profiler->head = (profiler->head + 1) % PROFILER_HISTORY;
+    if (profiler->count < PROFILER_HISTORY) {
+        profiler->count++;
+    }
+
+    if (SDL_GetTicks64() - profiler->last_refresh >= PROFILER_REFRESH_MS) {
+        Profiler_refresh(profiler);
+    }
+}
+
+void Profiler_countOp(Profiler* profiler, int graph_index) {
+    if (!profiler || graph_index < 0 || graph_index >= MAX_GRAPHS) return;
+    SDL_AtomicAdd(&profiler->ops[graph_index], 1);
+}
+
+void Profiler_toggle(Profiler* profiler) {
+    if (!profiler) return;
+    profiler->visible = !profiler->visible;
+    log_message(LOG_LEVEL_DEBUG, "Profiler overlay %s", profiler->visible ? "shown" : "hidden");
+}
+
+static int Profiler_compareFloat(const void* a, const void* b) {
+    float fa = *(const float*) a;
+    float fb = *(const float*) b;
+    return (fa > fb) - (fa < fb);
+}
+
+// Percentiles and histograms only change a few times per second, not worth recomputing every frame.
+static void Profiler_refresh(Profiler* profiler) {
+    Uint64 now = SDL_GetTicks64();
+    float elapsed_sec = (now - profiler->last_refresh) / 1000.f;
+    profiler->last_refresh = now;
+
+    float sorted[PROFILER_HISTORY];
+    int count = profiler->count;
+    for (int phase = 0; phase < PROFILER_PHASE_COUNT; phase++) {
+        memcpy(sorted, profiler->samples[phase], count * sizeof(float));
+        qsort(sorted, count, sizeof(float), Profiler_compareFloat);
+        profiler->p50[phase] = sorted[(count - 1) / 2];
+        profiler->p99[phase] = sorted[(count - 1) * 99 / 100];
+        profiler->max[phase] = sorted[count - 1];
+
+        memset(profiler->buckets[phase], 0, sizeof(profiler->buckets[phase]));
+        float bucket_width = profiler->max[phase] > 0 ? profiler->max[phase] / PROFILER_BUCKETS : 1.f;
+        for (int i = 0; i < count; i++) {
+            int bucket = (int) (sorted[i] / bucket_width);
+            profiler->buckets[phase][bucket >= PROFILER_BUCKETS ? PROFILER_BUCKETS - 1 : bucket]++;
+        }
+    }
+
+    profiler->dropped_window = 0;
+    for (int i = 0; i < count; i++) {
+        if (profiler->samples[PROFILER_PHASE_FRAME][i] > PROFILER_DROP_FACTOR * 1000.f / FRAME_RATE) {
+            profiler->dropped_window++;
+        }
+    }
+
+    for (int i = 0; i < MAX_GRAPHS; i++) {
+        int ops = SDL_AtomicGet(&profiler->ops[i]);
+        profiler->ops_per_sec[i] = elapsed_sec > 0 ? (ops - profiler->ops_seen[i]) / elapsed_sec : 0;
+        profiler->ops_seen[i] = ops;
+    }
+
+    if (profiler->visible) {
+        Profiler_updateLines(profiler);
+    }
+}
+
+static void Profiler_updateLines(Profiler* profiler) {
+    for (int phase = 0; phase < PROFILER_PHASE_COUNT; phase++) {
+        Text_setStringf(profiler->lines[phase], "%-8s p50 %6.2f ms  p99 %6.2f ms  max %6.2f ms",
+                        ProfilerPhase_toString(phase), profiler->p50[phase], profiler->p99[phase],
+                        profiler->max[phase]);
+    }
+    Text_setStringf(profiler->lines[PROFILER_PHASE_COUNT], "Dropped frames: %d in the last %d, %llu total",
+                    profiler->dropped_window, profiler->count, (unsigned long long) profiler->dropped_total);
+
+    char buffer[256] = "Sort steps/s:";
+    size_t len = strlen(buffer);
+    bool any = false;
+    for (int i = 0; i < MAX_GRAPHS && len < sizeof(buffer); i++) {
+        if (profiler->ops_per_sec[i] <= 0) continue;
+        len += snprintf(buffer + len, sizeof(buffer) - len, "  G%d %.0f", i + 1, profiler->ops_per_sec[i]);
+        any = true;
+    }
+    Text_setString(profiler->lines[PROFILER_PHASE_COUNT + 1], any ? buffer : "Sort steps/s: idle");
+}
+
+void Profiler_render(Profiler* profiler, App* app) {
+    if (!profiler || !profiler->visible) return;
+
+    if (!profiler->lines[0]) {
+        for (int i = 0; i < PROFILER_LINE_COUNT; i++) {
+            profiler->lines[i] = Text_new(app->renderer,
+                                          TextStyle_new(ResourceManager_getDefaultFont(app->manager, 14), 14,
+                                                        COLOR_WHITE, TTF_STYLE_NORMAL),
+                                          Position_new(0, 0), false, " ");
+        }
+        Profiler_updateLines(profiler);
+    }
+
+    const float x = 10;
+    const float line_height = 22;
+    const float histogram_width = PROFILER_BUCKETS * 3;
+    const float text_width = 360;
+    float y = 10;
+
+    SDL_Renderer* renderer = app->renderer;
+    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
+    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 190);
+    SDL_FRect background = {x - 5, y - 5, text_width + histogram_width + 20, line_height * PROFILER_LINE_COUNT + 10};
+    SDL_RenderFillRectF(renderer, &background);
+
+    for (int phase = 0; phase < PROFILER_PHASE_COUNT; phase++) {
+        Text_setPosition(profiler->lines[phase], x, y);
+        Text_render(profiler->lines[phase]);
+
+        int highest = 1;
+        for (int b = 0; b < PROFILER_BUCKETS; b++) {
+            if (profiler->buckets[phase][b] > highest) highest = profiler->buckets[phase][b];
+        }
+        SDL_SetRenderDrawColor(renderer, 90, 200, 120, 255);
+        for (int b = 0; b < PROFILER_BUCKETS; b++) {
+            if (profiler->buckets[phase][b] == 0) continue;
+            float bar_height = (line_height - 4) * profiler->buckets[phase][b] / highest;
+            SDL_FRect bar = {x + text_width + b * 3, y + line_height - 2 - bar_height, 2, bar_height};
+            SDL_RenderFillRectF(renderer, &bar);
+        }
+        y += line_height;
+    }
+    for (int i = PROFILER_PHASE_COUNT; i < PROFILER_LINE_COUNT; i++) {
+        Text_setPosition(profiler->lines[i], x, y);
+        Text_render(profiler->lines[i]);
+        y += line_height;
+    }
+}
+
+const char* ProfilerPhase_toString(ProfilerPhase phase) {
+    switch (phase) {
+        case PROFILER_PHASE_INPUT:
+            return "Input";
+        case PROFILER_PHASE_UPDATE:
+            return "Update";
+        case PROFILER_PHASE_RENDER:
+            return "Render";
+        case PROFILER_PHASE_PRESENT:
+            return "Present";
+        case PROFILER_PHASE_FRAME:
+            return "Frame";
+        default:
+            return "Unknown";
+    }
+}
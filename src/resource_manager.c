@@ -4,9 +4,11 @@
  */
 #include "resource_manager.h"
 
+#include "audio.h"
 #include "logger.h"
 #include "utils.h"
 #include "map.h"
+#include "oscillator.h"
 
 ResourceManager* ResourceManager_create(SDL_Renderer* renderer) {
     ResourceManager* self = calloc(1, sizeof(ResourceManager));
@@ -18,6 +20,7 @@ ResourceManager* ResourceManager_create(SDL_Renderer* renderer) {
     self->texturesCache = Map_create(true);
     self->fontsCache = Map_create(true);
     self->soundsCache = Map_create(true);
+    self->tonesCache = Map_create(false);
     return self;
 }
 
@@ -73,14 +76,25 @@ void ResourceManager_destroy(ResourceManager* self) {
         MapIterator_destroy(it);
         Map_destroy(self->soundsCache);
     }
+
+    if (self->tonesCache) {
+        MapIterator* it = MapIterator_new(self->tonesCache);
+        while (MapIterator_hasNext(it)) {
+            MapIterator_next(it);
+            Mix_FreeChunk((Mix_Chunk*)MapIterator_value(it));
+        }
+        MapIterator_destroy(it);
+        Map_destroy(self->tonesCache);
+    }
     safe_free((void**)&self);
 }
 
 SDL_Texture* ResourceManager_getTexture(ResourceManager* self, const char* filename) {
     if (!self || !self->texturesCache || !filename) return NULL;
 
-    if (Map_containsKey(self->texturesCache, (void*)filename)) {
-        return Map_get(self->texturesCache, (void*)filename);
+    SDL_Texture* cached = Map_get(self->texturesCache, (void*)filename);
+    if (cached) {
+        return cached;
     }
 
     char* path = malloc(strlen(TEXTURE_PATH) + strlen(filename) + 1);
@@ -100,10 +114,11 @@ SDL_Texture* ResourceManager_getTexture(ResourceManager* self, const char* filen
 TTF_Font* ResourceManager_getFont(ResourceManager* self, const char* filename, int size) {
     if (!self || !self->fontsCache || !filename) return NULL;
 
-    if (Map_containsKey(self->fontsCache, (void*)filename)) {
-        Map* sizeMap = Map_get(self->fontsCache, (void*)filename);
-        if (Map_containsKey(sizeMap, (void*)(long)size)) {
-            return Map_get(sizeMap, (void*)(long)size);
+    Map* sizeMap = Map_get(self->fontsCache, (void*)filename);
+    if (sizeMap) {
+        TTF_Font* cached = Map_get(sizeMap, (void*)(long)size);
+        if (cached) {
+            return cached;
         }
     }
 
@@ -116,11 +131,10 @@ TTF_Font* ResourceManager_getFont(ResourceManager* self, const char* filename, i
         return NULL;
     }
 
-    if (Map_containsKey(self->fontsCache, (void*)filename)) {
-        Map* existingFont = Map_get(self->fontsCache, (void*)filename);
-        Map_put(existingFont, (void*)(long)size, font);
+    if (sizeMap) {
+        Map_put(sizeMap, (void*)(long)size, font);
     } else {
-        Map* sizeMap = Map_create(false);
+        sizeMap = Map_create(false);
         Map_put(sizeMap, (void*)(long)size, font);
         Map_put(self->fontsCache, Strdup(filename), sizeMap);
         log_message(LOG_LEVEL_INFO, "Loaded new font from %s", path);
@@ -132,8 +146,9 @@ TTF_Font* ResourceManager_getFont(ResourceManager* self, const char* filename, i
 Mix_Chunk* ResourceManager_getSound(ResourceManager* self, const char* filename) {
     if (!self || !self->soundsCache || !filename) return NULL;
 
-    if (Map_containsKey(self->soundsCache, (void*)filename)) {
-        return Map_get(self->soundsCache, (void*)filename);
+    Mix_Chunk* cached = Map_get(self->soundsCache, (void*)filename);
+    if (cached) {
+        return cached;
     }
 
     char* path = malloc(strlen(SOUND_PATH) + strlen(filename) + 1);
@@ -150,6 +165,27 @@ Mix_Chunk* ResourceManager_getSound(ResourceManager* self, const char* filename)
     return sound;
 }
 
+Mix_Chunk* ResourceManager_getTone(ResourceManager* self, Waveform waveform, int frequency, int duration_ms) {
+    if (!self || !self->tonesCache || waveform >= WAVEFORM_COUNT) return NULL;
+    if (frequency <= 0 || frequency > RESOURCE_TONE_MAX || duration_ms <= 0 || duration_ms > RESOURCE_TONE_MAX) {
+        log_message(LOG_LEVEL_WARN, "Tone %d Hz, %d ms out of range", frequency, duration_ms);
+        return NULL;
+    }
+
+    // Fits in 32 bits so the key stays valid where long is 32 bits.
+    long key = (long) waveform << 28 | (long) frequency << 14 | duration_ms;
+    Mix_Chunk* cached = Map_get(self->tonesCache, (void*)key);
+    if (cached) {
+        return cached;
+    }
+
+    Mix_Chunk* tone = Audio_createTone(waveform, frequency, duration_ms);
+    if (!tone) return NULL;
+    Map_put(self->tonesCache, (void*)key, tone);
+    log_message(LOG_LEVEL_DEBUG, "Rendered %s tone %d Hz, %d ms", Waveform_toString(waveform), frequency, duration_ms);
+    return tone;
+}
+
 TTF_Font* ResourceManager_getDefaultFont(ResourceManager* self, int size) {
     return ResourceManager_getFont(self, DEFAULT_FONT, size);
 }
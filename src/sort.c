@@ -5,60 +5,57 @@
 #include "sort.h"
 
 #include "column_graph.h"
-#include "list.h"
+#include "vector.h"
 #include "logger.h"
+#include "parallel_sort.h"
 #include "stats.h"
 #include "utils.h"
 
-int List_defaultCompare(const void* a, const void* b) {
+int Vector_defaultCompare(const void* a, const void* b) {
     return (long)a - (long)b;
 }
 
-bool List_isSorted(List* list, CompareFunc compare_func) {
+bool Vector_isSorted(Vector* list, CompareFunc compare_func) {
     if (!list || list->size < 2) return true;
     if (!compare_func) {
-        compare_func = List_defaultCompare;
+        compare_func = Vector_defaultCompare;
     }
 
-    ListNode* node = list->head->next;
-    while (node->next != list->head) {
-        if (compare_func(node->value, node->next->value) > 0) {
+    for (size_t i = 0; i + 1 < list->size; i++) {
+        if (compare_func(list->data[i], list->data[i + 1]) > 0) {
             return false;
         }
-        node = node->next;
     }
     return true;
 }
 
 
-void List_sortBubble(List* list, CompareFunc compare_func, SDL_mutex* gm, DelayFunc delay_func, MainFrame* mainframe, ColumnGraph* column_graph) {
+void Vector_sortBubble(Vector* list, CompareFunc compare_func, SDL_mutex* gm, DelayFunc delay_func, MainFrame* mainframe, ColumnGraph* column_graph) {
     if (!list || list->size < 2) return;
     if (!compare_func) {
-        compare_func = List_defaultCompare;
+        compare_func = Vector_defaultCompare;
     }
 
     bool swapped;
     do {
         swapped = false;
-        ListNode* node = list->head->next;
-        while (node->next != list->head) {
-            ListNode* next = node->next;
-            void* a = node->value;
-            void* b = next->value;
+        for (size_t i = 0; i + 1 < list->size; i++) {
+            void* a = list->data[i];
+            void* b = list->data[i + 1];
 
             if (column_graph && column_graph->stats) {
-                GraphStats_incrementAccessMemory(column_graph->stats, 2);
+                GraphStats_incrementReads(column_graph->stats, 2);
                 GraphStats_incrementComparisons(column_graph->stats);
             }
 
             if (compare_func(a, b) > 0) {
                 SDL_LockMutex(gm);
-                void* temp = node->value;
-                node->value = next->value;
-                next->value = temp;
+                list->data[i] = b;
+                list->data[i + 1] = a;
                 if (column_graph && column_graph->stats) {
                     GraphStats_incrementSwaps(column_graph->stats);
-                    GraphStats_incrementAccessMemory(column_graph->stats, 3);
+                    GraphStats_incrementReads(column_graph->stats, 1);
+                    GraphStats_incrementWrites(column_graph->stats, 2);
                 }
                 SDL_UnlockMutex(gm);
                 if (delay_func) {
@@ -66,98 +63,80 @@ void List_sortBubble(List* list, CompareFunc compare_func, SDL_mutex* gm, DelayF
                 }
                 swapped = true;
             }
-            node = next;
         }
     } while (swapped);
 }
 
-static ListNode* partitionQS(ListNode* low, ListNode* high, CompareFunc compare_func, SDL_mutex* gm, DelayFunc delay_func, MainFrame* mainframe, ColumnGraph* column_graph) {
-    void* pivot = high->value;
+static long partitionQS(Vector* list, long low, long high, CompareFunc compare_func, SDL_mutex* gm, DelayFunc delay_func, MainFrame* mainframe, ColumnGraph* column_graph) {
+    void** data = list->data;
+    void* pivot = data[high];
     if (column_graph && column_graph->stats) {
-        GraphStats_incrementAccessMemory(column_graph->stats, 1);
+        GraphStats_incrementReads(column_graph->stats, 1);
     }
-    ListNode* i = low ? low->prev : NULL;
-    for (ListNode* j = low; j != high; j = j->next) {
+    long i = low - 1;
+    for (long j = low; j < high; j++) {
         if (column_graph && column_graph->stats) {
             GraphStats_incrementComparisons(column_graph->stats);
-            GraphStats_incrementAccessMemory(column_graph->stats, 2);
+            GraphStats_incrementReads(column_graph->stats, 2);
         }
-        if (compare_func(j->value, pivot) <= 0) {
-            i = (i == NULL) ? low : i->next;
+        if (compare_func(data[j], pivot) <= 0) {
+            i++;
             SDL_LockMutex(gm);
-            void* tmp = i->value;
-            i->value = j->value;
-            j->value = tmp;
+            void* tmp = data[i];
+            data[i] = data[j];
+            data[j] = tmp;
             if (column_graph && column_graph->stats) {
                 GraphStats_incrementSwaps(column_graph->stats);
-                GraphStats_incrementAccessMemory(column_graph->stats, 3);
+                GraphStats_incrementReads(column_graph->stats, 1);
+                GraphStats_incrementWrites(column_graph->stats, 2);
             }
             SDL_UnlockMutex(gm);
             if (delay_func) {
-                delay_func(mainframe, column_graph, j->value, i->value);
+                delay_func(mainframe, column_graph, data[j], data[i]);
             }
         }
     }
-    i = (i == NULL) ? low : i->next;
+    i++;
     SDL_LockMutex(gm);
-    void* tmp = i->value;
-    i->value = high->value;
-    high->value = tmp;
+    void* tmp = data[i];
+    data[i] = data[high];
+    data[high] = tmp;
     if (column_graph && column_graph->stats) {
         GraphStats_incrementSwaps(column_graph->stats);
-        GraphStats_incrementAccessMemory(column_graph->stats, 3);
+        GraphStats_incrementReads(column_graph->stats, 1);
+        GraphStats_incrementWrites(column_graph->stats, 2);
     }
     SDL_UnlockMutex(gm);
     if (delay_func) {
-        delay_func(mainframe, column_graph, i->value, high->value);
+        delay_func(mainframe, column_graph, data[i], data[high]);
     }
     return i;
 }
 
-static void quickSortRec(ListNode* low, ListNode* high, CompareFunc compare_func, SDL_mutex* gm, DelayFunc delay_func, MainFrame* mainframe, ColumnGraph* column_graph) {
-    if (!low || !high) return;
-    if (low != high && low != high->next) {
-        ListNode* p = partitionQS(low, high, compare_func, gm, delay_func, mainframe, column_graph);
+static void quickSortRec(Vector* list, long low, long high, CompareFunc compare_func, SDL_mutex* gm, DelayFunc delay_func, MainFrame* mainframe, ColumnGraph* column_graph) {
+    if (low < high) {
+        long p = partitionQS(list, low, high, compare_func, gm, delay_func, mainframe, column_graph);
 
-        quickSortRec(low, p->prev, compare_func, gm, delay_func, mainframe, column_graph);
-        quickSortRec(p->next, high, compare_func, gm, delay_func, mainframe, column_graph);
+        quickSortRec(list, low, p - 1, compare_func, gm, delay_func, mainframe, column_graph);
+        quickSortRec(list, p + 1, high, compare_func, gm, delay_func, mainframe, column_graph);
     }
 }
 
-void List_sortQuick(List* list, CompareFunc compare_func, SDL_mutex* gm, DelayFunc delay_func, MainFrame* mainframe, ColumnGraph* column_graph) {
+void Vector_sortQuick(Vector* list, CompareFunc compare_func, SDL_mutex* gm, DelayFunc delay_func, MainFrame* mainframe, ColumnGraph* column_graph) {
     if (!list || list->size < 2) return;
 
     if (!compare_func) {
-        compare_func = List_defaultCompare;
+        compare_func = Vector_defaultCompare;
     }
 
-    ListNode* first = list->head->next;
-    ListNode* last = list->head->prev;
-
-    first->prev = NULL;
-    last->next = NULL;
-
-    quickSortRec(first, last, compare_func, gm, delay_func, mainframe, column_graph);
-
-    ListNode* new_first = first;
-    while (new_first->prev) {
-        new_first = new_first->prev;
-    }
-    ListNode* new_last = last;
-    while (new_last->next) {
-        new_last = new_last->next;
-    }
-    new_first->prev = list->head;
-    new_last->next = list->head;
-    list->head->next = new_first;
-    list->head->prev = new_last;
+    quickSortRec(list, 0, (long)list->size - 1, compare_func, gm, delay_func, mainframe, column_graph);
 }
 
-static void merge(List* list, void** temp_values, int left, int mid, int right, CompareFunc compare_func, SDL_mutex* gm, DelayFunc delay_func, MainFrame* mainframe, ColumnGraph* column_graph) {
+static void merge(Vector* list, void** temp_values, int left, int mid, int right, CompareFunc compare_func, SDL_mutex* gm, DelayFunc delay_func, MainFrame* mainframe, ColumnGraph* column_graph) {
     for (int i = left; i <= right; i++) {
-        temp_values[i] = List_get(list, i);
+        temp_values[i] = Vector_get(list, i);
         if (column_graph && column_graph->stats) {
-            GraphStats_incrementAccessMemory(column_graph->stats, 1);
+            GraphStats_incrementReads(column_graph->stats, 1);
         }
     }
 
@@ -168,23 +147,23 @@ static void merge(List* list, void** temp_values, int left, int mid, int right,
     while (i <= mid && j <= right) {
         if (column_graph && column_graph->stats) {
             GraphStats_incrementComparisons(column_graph->stats);
-            GraphStats_incrementAccessMemory(column_graph->stats, 2);
+            GraphStats_incrementReads(column_graph->stats, 2);
         }
         if (compare_func(temp_values[i], temp_values[j]) <= 0) {
             SDL_LockMutex(gm);
-            List_set(list, k, temp_values[i]);
+            Vector_set(list, k, temp_values[i]);
             SDL_UnlockMutex(gm);
             if (column_graph && column_graph->stats) {
-                GraphStats_incrementAccessMemory(column_graph->stats, 1);
+                GraphStats_incrementWrites(column_graph->stats, 1);
             }
             if (delay_func) delay_func(mainframe, column_graph, temp_values[i], NULL);
             i++;
         } else {
             SDL_LockMutex(gm);
-            List_set(list, k, temp_values[j]);
+            Vector_set(list, k, temp_values[j]);
             SDL_UnlockMutex(gm);
             if (column_graph && column_graph->stats) {
-                GraphStats_incrementAccessMemory(column_graph->stats, 1);
+                GraphStats_incrementWrites(column_graph->stats, 1);
             }
             if (delay_func) delay_func(mainframe, column_graph, temp_values[j], NULL);
             j++;
@@ -194,10 +173,10 @@ static void merge(List* list, void** temp_values, int left, int mid, int right,
 
     while (i <= mid) {
         SDL_LockMutex(gm);
-        List_set(list, k, temp_values[i]);
+        Vector_set(list, k, temp_values[i]);
         SDL_UnlockMutex(gm);
         if (column_graph && column_graph->stats) {
-            GraphStats_incrementAccessMemory(column_graph->stats, 1);
+            GraphStats_incrementWrites(column_graph->stats, 1);
         }
         if (delay_func) delay_func(mainframe, column_graph, temp_values[i], NULL);
         i++;
@@ -206,10 +185,10 @@ static void merge(List* list, void** temp_values, int left, int mid, int right,
 
     while (j <= right) {
         SDL_LockMutex(gm);
-        List_set(list, k, temp_values[j]);
+        Vector_set(list, k, temp_values[j]);
         SDL_UnlockMutex(gm);
         if (column_graph && column_graph->stats) {
-            GraphStats_incrementAccessMemory(column_graph->stats, 1);
+            GraphStats_incrementWrites(column_graph->stats, 1);
         }
         if (delay_func) delay_func(mainframe, column_graph, temp_values[j], NULL);
         j++;
@@ -217,7 +196,7 @@ static void merge(List* list, void** temp_values, int left, int mid, int right,
     }
 }
 
-void mergeSortRec(List* list, void** temp_values, int left, int right, CompareFunc compare_func, SDL_mutex* gm, DelayFunc delay_func, MainFrame* mainframe, ColumnGraph* column_graph) {
+void mergeSortRec(Vector* list, void** temp_values, int left, int right, CompareFunc compare_func, SDL_mutex* gm, DelayFunc delay_func, MainFrame* mainframe, ColumnGraph* column_graph) {
     if (left < right) {
         int mid = left + (right - left) / 2;
         mergeSortRec(list, temp_values, left, mid, compare_func, gm, delay_func, mainframe, column_graph);
@@ -226,10 +205,10 @@ void mergeSortRec(List* list, void** temp_values, int left, int right, CompareFu
     }
 }
 
-void List_sortMerge(List* list, CompareFunc compare_func, SDL_mutex* gm, DelayFunc delay_func, MainFrame* mainframe, ColumnGraph* column_graph) {
+void Vector_sortMerge(Vector* list, CompareFunc compare_func, SDL_mutex* gm, DelayFunc delay_func, MainFrame* mainframe, ColumnGraph* column_graph) {
     if (!list || list->size < 2) return;
     if (!compare_func) {
-        compare_func = List_defaultCompare;
+        compare_func = Vector_defaultCompare;
     }
 
     void** temp_values = malloc(list->size * sizeof(void*));
@@ -238,34 +217,38 @@ void List_sortMerge(List* list, CompareFunc compare_func, SDL_mutex* gm, DelayFu
         return;
     }
 
+    GraphStats* stats = column_graph ? column_graph->stats : NULL;
+    GraphStats_allocAux(stats, list->size * sizeof(void*));
+
     mergeSortRec(list, temp_values, 0, list->size - 1, compare_func, gm, delay_func, mainframe, column_graph);
 
     free(temp_values);
+    GraphStats_freeAux(stats, list->size * sizeof(void*));
 }
 
-void List_sortInsertion(List* list, CompareFunc compare_func, SDL_mutex* gm, DelayFunc delay_func, MainFrame* mainframe, ColumnGraph* column_graph) {
+void Vector_sortInsertion(Vector* list, CompareFunc compare_func, SDL_mutex* gm, DelayFunc delay_func, MainFrame* mainframe, ColumnGraph* column_graph) {
     if (!list || list->size < 2) return;
 
     if (!compare_func) {
-        compare_func = List_defaultCompare;
+        compare_func = Vector_defaultCompare;
     }
 
     for (size_t i = 1; i < list->size; i++) {
-        void* key = List_get(list, i);
+        void* key = Vector_get(list, i);
         if (column_graph && column_graph->stats) {
-            GraphStats_incrementAccessMemory(column_graph->stats, 1);
+            GraphStats_incrementReads(column_graph->stats, 1);
         }
         int j = i - 1;
 
         while (j >= 0) {
             if (column_graph && column_graph->stats) {
                 GraphStats_incrementComparisons(column_graph->stats);
-                GraphStats_incrementAccessMemory(column_graph->stats, 2);
+                GraphStats_incrementReads(column_graph->stats, 2);
             }
-            if (compare_func(List_get(list, j), key) > 0) {
+            if (compare_func(Vector_get(list, j), key) > 0) {
                 SDL_LockMutex(gm);
-                void* value_to_move = List_get(list, j);
-                List_set(list, j + 1, value_to_move);
+                void* value_to_move = Vector_get(list, j);
+                Vector_set(list, j + 1, value_to_move);
                 SDL_UnlockMutex(gm);
                 if (delay_func) {
                     delay_func(mainframe, column_graph, value_to_move, key);
@@ -276,9 +259,9 @@ void List_sortInsertion(List* list, CompareFunc compare_func, SDL_mutex* gm, Del
             }
         }
         SDL_LockMutex(gm);
-        List_set(list, j + 1, key);
+        Vector_set(list, j + 1, key);
         if (column_graph && column_graph->stats) {
-            GraphStats_incrementAccessMemory(column_graph->stats, 1);
+            GraphStats_incrementWrites(column_graph->stats, 1);
         }
         SDL_UnlockMutex(gm);
         if (delay_func) {
@@ -287,22 +270,23 @@ void List_sortInsertion(List* list, CompareFunc compare_func, SDL_mutex* gm, Del
     }
 }
 
-static void bitonicMerge(List* list, int low, int count, int direction, CompareFunc compare_func, SDL_mutex* gm, DelayFunc delay_func, MainFrame* mainframe, ColumnGraph* column_graph) {
+static void bitonicMerge(Vector* list, int low, int count, int direction, CompareFunc compare_func, SDL_mutex* gm, DelayFunc delay_func, MainFrame* mainframe, ColumnGraph* column_graph) {
     if (count > 1) {
         int k = count / 2;
         for (int i = low; i < low + k; i++) {
-            void* val1 = List_get(list, i);
-            void* val2 = List_get(list, i + k);
+            void* val1 = Vector_get(list, i);
+            void* val2 = Vector_get(list, i + k);
             if (column_graph && column_graph->stats) {
-                GraphStats_incrementAccessMemory(column_graph->stats, 2);
+                GraphStats_incrementReads(column_graph->stats, 2);
                 GraphStats_incrementComparisons(column_graph->stats);
             }
             if ((direction == 1 && compare_func(val1, val2) > 0) || (direction == 0 && compare_func(val1, val2) < 0)) {
                 SDL_LockMutex(gm);
-                List_swap(list, i, i + k);
+                Vector_swap(list, i, i + k);
                 if (column_graph && column_graph->stats) {
                     GraphStats_incrementSwaps(column_graph->stats);
-                    GraphStats_incrementAccessMemory(column_graph->stats, 3);
+                    GraphStats_incrementReads(column_graph->stats, 1);
+                    GraphStats_incrementWrites(column_graph->stats, 2);
                 }
                 SDL_UnlockMutex(gm);
                 if (delay_func) {
@@ -315,7 +299,7 @@ static void bitonicMerge(List* list, int low, int count, int direction, CompareF
     }
 }
 
-static void bitonicSortRec(List* list, int low, int count, int direction, CompareFunc compare_func, SDL_mutex* gm, DelayFunc delay_func, MainFrame* mainframe, ColumnGraph* column_graph) {
+static void bitonicSortRec(Vector* list, int low, int count, int direction, CompareFunc compare_func, SDL_mutex* gm, DelayFunc delay_func, MainFrame* mainframe, ColumnGraph* column_graph) {
     if (count > 1) {
         int k = count / 2;
         bitonicSortRec(list, low, k, 1, compare_func, gm, delay_func, mainframe, column_graph);
@@ -324,62 +308,60 @@ static void bitonicSortRec(List* list, int low, int count, int direction, Compar
     }
 }
 
-void List_sortBitonic(List* list, CompareFunc compare_func, SDL_mutex* gm, DelayFunc delay_func, MainFrame* mainframe, ColumnGraph* column_graph) {
+void Vector_sortBitonic(Vector* list, CompareFunc compare_func, SDL_mutex* gm, DelayFunc delay_func, MainFrame* mainframe, ColumnGraph* column_graph) {
     if (!list || list->size < 2) return;
     if ((list->size & (list->size - 1)) != 0) {
         log_message(LOG_LEVEL_ERROR, "Bitonic sort requires the list size to be a power of 2.");
         return;
     }
     if (!compare_func) {
-        compare_func = List_defaultCompare;
+        compare_func = Vector_defaultCompare;
     }
     bitonicSortRec(list, 0, list->size, 1, compare_func, gm, delay_func, mainframe, column_graph);
 }
 
-void List_sortBogo(List* list, CompareFunc compare_func, SDL_mutex* gm, DelayFunc delay_func, MainFrame* mainframe, ColumnGraph* column_graph) {
+void Vector_sortBogo(Vector* list, CompareFunc compare_func, SDL_mutex* gm, DelayFunc delay_func, MainFrame* mainframe, ColumnGraph* column_graph) {
     if (!list || list->size < 2) return;
 
     if (!compare_func) {
-        compare_func = List_defaultCompare;
+        compare_func = Vector_defaultCompare;
     }
     bool sorted = false;
 
     while (!sorted) {
         SDL_LockMutex(gm);
-        List_shuffle(list, NULL);
+        Vector_shuffle(list, NULL);
         if (column_graph && column_graph->stats) {
-            GraphStats_incrementAccessMemory(column_graph->stats, (int)list->size);
+            GraphStats_incrementWrites(column_graph->stats, (int)list->size);
         }
         SDL_UnlockMutex(gm);
         if (delay_func) {
             delay_func(mainframe, column_graph, NULL, NULL);
         }
         sorted = true;
-        ListNode* node = list->head->next;
-        while (node->next != list->head) {
-            if (compare_func(node->value, node->next->value) > 0) {
+        for (size_t i = 0; i + 1 < list->size; i++) {
+            if (compare_func(list->data[i], list->data[i + 1]) > 0) {
                 sorted = false;
                 break;
             }
-            node = node->next;
             if (column_graph && column_graph->stats) {
-                GraphStats_incrementAccessMemory(column_graph->stats, 2);
+                GraphStats_incrementReads(column_graph->stats, 2);
                 GraphStats_incrementComparisons(column_graph->stats);
             }
         }
     }
 }
 
-void List_sortSelection(List* list, CompareFunc compare_func, SDL_mutex* gm, DelayFunc delay_func, MainFrame* mainframe, ColumnGraph* column_graph) {
+void Vector_sortSelection(Vector* list, CompareFunc compare_func, SDL_mutex* gm, DelayFunc delay_func, MainFrame* mainframe, ColumnGraph* column_graph) {
     if (!list || list->size < 2) return;
 
     for (int i = 0; i < (int)list->size - 1; i++) {
         int min = i;
         for (int j = i+1; j < (int)list->size; j++) {
-            void* a = List_get(list, j);
-            void* b = List_get(list, min);
+            void* a = Vector_get(list, j);
+            void* b = Vector_get(list, min);
             if (column_graph && column_graph->stats) {
-                GraphStats_incrementAccessMemory(column_graph->stats, 2);
+                GraphStats_incrementReads(column_graph->stats, 2);
                 GraphStats_incrementComparisons(column_graph->stats);
             }
 
@@ -389,26 +371,27 @@ void List_sortSelection(List* list, CompareFunc compare_func, SDL_mutex* gm, Del
         }
         if (min != i) {
             SDL_LockMutex(gm);
-            List_swap(list, i, min);
+            Vector_swap(list, i, min);
             if (column_graph && column_graph->stats) {
                 GraphStats_incrementSwaps(column_graph->stats);
-                GraphStats_incrementAccessMemory(column_graph->stats, 3);
+                GraphStats_incrementReads(column_graph->stats, 1);
+                GraphStats_incrementWrites(column_graph->stats, 2);
             }
             SDL_UnlockMutex(gm);
             if (delay_func) {
-                delay_func(mainframe, column_graph, List_get(list, i), List_get(list, min));
+                delay_func(mainframe, column_graph, Vector_get(list, i), Vector_get(list, min));
             }
         }
     }
 }
 
 
-void List_sortRadix(List* list, CompareFunc compare_func, SDL_mutex* gm, DelayFunc delay_func, MainFrame* mainframe, ColumnGraph* column_graph) {
+void Vector_sortRadix(Vector* list, CompareFunc compare_func, SDL_mutex* gm, DelayFunc delay_func, MainFrame* mainframe, ColumnGraph* column_graph) {
     if (column_graph->type != GRAPH_TYPE_INT) {
         log_message(LOG_LEVEL_WARN, "Radix sort only supports integer lists.");
         return;
     }
-    ColumnGraphBar* max_bar = List_max(list, compare_func);
+    ColumnGraphBar* max_bar = Vector_max(list, compare_func);
     if (column_graph->stats) {
         column_graph->stats->comparisons += (long)list->size - 1;
     }
@@ -419,79 +402,1150 @@ void List_sortRadix(List* list, CompareFunc compare_func, SDL_mutex* gm, DelayFu
     }
     long max_value = (long)max_bar->value;
     for (long exp = 1; max_value / exp > 0; exp*=10) {
-        List* output = List_create();
+        Vector* output = Vector_createWithCapacity(list->size);
+        if (!output) {
+            error("Failed to allocate memory for radix sort output");
+            return;
+        }
+        GraphStats_allocAux(column_graph->stats, sizeof(Vector) + list->size * sizeof(void*));
         for (int i = 0; i < (int)list->size; i++) {
-            List_push(output, 0);
+            Vector_push(output, NULL);
             if (column_graph->stats) {
-                GraphStats_incrementAccessMemory(column_graph->stats, 1);
+                GraphStats_incrementWrites(column_graph->stats, 1);
             }
         }
         long count[10] = { 0 };
         for (size_t i = 0; i < list->size; i++ ) {
-            ColumnGraphBar* bar = List_get(list, i);
+            ColumnGraphBar* bar = Vector_get(list, i);
             if (column_graph->stats) {
-                GraphStats_incrementAccessMemory(column_graph->stats, 1);
+                GraphStats_incrementReads(column_graph->stats, 1);
             }
             int idx = ((long)bar->value / exp) % 10;
             count[idx]++;
             if (column_graph->stats) {
-                GraphStats_incrementAccessMemory(column_graph->stats, 1);
+                GraphStats_incrementWrites(column_graph->stats, 1);
             }
         }
         for (int i = 1; i < 10; i++) {
             count[i] += count[i - 1];
             if (column_graph->stats) {
-                GraphStats_incrementAccessMemory(column_graph->stats, 1);
+                GraphStats_incrementWrites(column_graph->stats, 1);
             }
         }
         for (int i = list->size - 1; i >= 0; i--) {
-            ColumnGraphBar* bar = List_get(list, i);
-            List_set(output, count[((long)bar->value / exp) % 10] - 1, List_get(list, i));
+            ColumnGraphBar* bar = Vector_get(list, i);
+            Vector_set(output, count[((long)bar->value / exp) % 10] - 1, Vector_get(list, i));
             count[((long)bar->value / exp) % 10]--;
             if (column_graph->stats) {
-                GraphStats_incrementAccessMemory(column_graph->stats, 2);
+                GraphStats_incrementReads(column_graph->stats, 1);
+                GraphStats_incrementWrites(column_graph->stats, 1);
             }
         }
         for (size_t i = 0; i < list->size; i++) {
             SDL_LockMutex(gm);
-            List_set(list, i, List_get(output, i));
+            Vector_set(list, i, Vector_get(output, i));
             if (column_graph->stats) {
-                GraphStats_incrementAccessMemory(column_graph->stats, 1);
+                GraphStats_incrementWrites(column_graph->stats, 1);
+            }
+            SDL_UnlockMutex(gm);
+            if (delay_func) {
+                delay_func(mainframe, column_graph, Vector_get(list, i), NULL);
+            }
+        }
+        Vector_destroy(output);
+        GraphStats_freeAux(column_graph->stats, sizeof(Vector) + list->size * sizeof(void*));
+    }
+}
+
+// Walk from root down the largest children to a leaf, then back up to the
+// slot where the root value belongs, and rotate the path by one level.
+static void heapSiftDown(Vector* list, size_t root, size_t size, size_t arity, CompareFunc compare_func, SDL_mutex* gm, DelayFunc delay_func, MainFrame* mainframe, ColumnGraph* column_graph) {
+    void** data = list->data;
+    size_t j = root;
+    while (arity * j + 1 < size) {
+        size_t child = arity * j + 1;
+        size_t last = child + arity < size ? child + arity : size;
+        size_t largest = child;
+        for (size_t c = child + 1; c < last; c++) {
+            if (column_graph && column_graph->stats) {
+                GraphStats_incrementComparisons(column_graph->stats);
+                GraphStats_incrementReads(column_graph->stats, 2);
+            }
+            if (compare_func(data[c], data[largest]) > 0) {
+                largest = c;
+            }
+        }
+        j = largest;
+    }
+    while (j > root) {
+        if (column_graph && column_graph->stats) {
+            GraphStats_incrementComparisons(column_graph->stats);
+            GraphStats_incrementReads(column_graph->stats, 2);
+        }
+        if (compare_func(data[root], data[j]) <= 0) break;
+        j = (j - 1) / arity;
+    }
+    if (j == root) return;
+
+    void* moving = data[root];
+    void* carried = data[j];
+    SDL_LockMutex(gm);
+    data[j] = moving;
+    if (column_graph && column_graph->stats) {
+        GraphStats_incrementReads(column_graph->stats, 1);
+        GraphStats_incrementWrites(column_graph->stats, 1);
+    }
+    SDL_UnlockMutex(gm);
+    while (j > root) {
+        j = (j - 1) / arity;
+        SDL_LockMutex(gm);
+        void* tmp = data[j];
+        data[j] = carried;
+        if (column_graph && column_graph->stats) {
+            GraphStats_incrementSwaps(column_graph->stats);
+            GraphStats_incrementReads(column_graph->stats, 1);
+            GraphStats_incrementWrites(column_graph->stats, 1);
+        }
+        SDL_UnlockMutex(gm);
+        if (delay_func) {
+            delay_func(mainframe, column_graph, carried, moving);
+        }
+        carried = tmp;
+    }
+}
+
+static void heapSort(Vector* list, size_t arity, CompareFunc compare_func, SDL_mutex* gm, DelayFunc delay_func, MainFrame* mainframe, ColumnGraph* column_graph) {
+    if (!list || list->size < 2) return;
+    if (!compare_func) {
+        compare_func = Vector_defaultCompare;
+    }
+
+    for (size_t i = (list->size - 2) / arity + 1; i-- > 0;) {
+        heapSiftDown(list, i, list->size, arity, compare_func, gm, delay_func, mainframe, column_graph);
+    }
+    for (size_t end = list->size - 1; end > 0; end--) {
+        SDL_LockMutex(gm);
+        Vector_swap(list, 0, end);
+        if (column_graph && column_graph->stats) {
+            GraphStats_incrementSwaps(column_graph->stats);
+            GraphStats_incrementReads(column_graph->stats, 1);
+            GraphStats_incrementWrites(column_graph->stats, 2);
+        }
+        SDL_UnlockMutex(gm);
+        if (delay_func) {
+            delay_func(mainframe, column_graph, Vector_get(list, end), Vector_get(list, 0));
+        }
+        heapSiftDown(list, 0, end, arity, compare_func, gm, delay_func, mainframe, column_graph);
+    }
+}
+
+void Vector_sortHeap(Vector* list, CompareFunc compare_func, SDL_mutex* gm, DelayFunc delay_func, MainFrame* mainframe, ColumnGraph* column_graph) {
+    if (!list) return;
+    size_t arity = list->size >= SORT_HEAP_QUATERNARY_THRESHOLD ? 4 : 2;
+    heapSort(list, arity, compare_func, gm, delay_func, mainframe, column_graph);
+}
+
+void Vector_sortHeapQuaternary(Vector* list, CompareFunc compare_func, SDL_mutex* gm, DelayFunc delay_func, MainFrame* mainframe, ColumnGraph* column_graph) {
+    heapSort(list, 4, compare_func, gm, delay_func, mainframe, column_graph);
+}
+
+// Fills gaps with the gaps of sequence below size, in increasing order, and returns how many there are.
+static size_t shellGaps(ShellGapSequence sequence, size_t size, size_t* gaps) {
+    static const size_t ciura[] = {1, 4, 10, 23, 57, 132, 301, 701, 1750};
+    size_t count = 0;
+    switch (sequence) {
+        case SHELL_GAPS_TOKUDA: {
+            double h = 1.0;
+            for (size_t gap = 1; gap < size && count < SORT_SHELL_MAX_GAPS; gap = (size_t) ceil(h)) {
+                gaps[count++] = gap;
+                h = 2.25 * h + 1.0;
+            }
+            break;
+        }
+        case SHELL_GAPS_SEDGEWICK:
+            // 4^k + 3 * 2^(k - 1) + 1, preceded by 1.
+            gaps[count++] = 1;
+            for (size_t k = 1; count < SORT_SHELL_MAX_GAPS; k++) {
+                size_t gap = ((size_t) 1 << (2 * k)) + 3 * ((size_t) 1 << (k - 1)) + 1;
+                if (gap >= size) break;
+                gaps[count++] = gap;
+            }
+            break;
+        case SHELL_GAPS_PRATT:
+            // Every 2^p * 3^q, many small passes in which an element moves at most once.
+            for (size_t power3 = 1; power3 < size; power3 *= 3) {
+                for (size_t gap = power3; gap < size && count < SORT_SHELL_MAX_GAPS; gap *= 2) {
+                    size_t j = count++;
+                    for (; j > 0 && gaps[j - 1] > gap; j--) {
+                        gaps[j] = gaps[j - 1];
+                    }
+                    gaps[j] = gap;
+                }
+            }
+            break;
+        case SHELL_GAPS_CIURA:
+        default:
+            // Ciura's measured gaps, then the usual 2.25 ratio past them.
+            for (size_t i = 0; i < sizeof(ciura) / sizeof(ciura[0]) && ciura[i] < size; i++) {
+                gaps[count++] = ciura[i];
+            }
+            if (count == sizeof(ciura) / sizeof(ciura[0])) {
+                for (size_t gap = gaps[count - 1] * 9 / 4; gap < size && count < SORT_SHELL_MAX_GAPS; gap = gap * 9 / 4) {
+                    gaps[count++] = gap;
+                }
+            }
+            break;
+    }
+    return count;
+}
+
+void Vector_sortShell(Vector* list, CompareFunc compare_func, SDL_mutex* gm, DelayFunc delay_func, MainFrame* mainframe, ColumnGraph* column_graph) {
+    if (!list || list->size < 2) return;
+    if (!compare_func) {
+        compare_func = Vector_defaultCompare;
+    }
+
+    ShellGapSequence sequence = column_graph ? column_graph->shell_gaps : SHELL_GAPS_CIURA;
+    GraphStats* stats = column_graph ? column_graph->stats : NULL;
+    size_t gaps[SORT_SHELL_MAX_GAPS];
+    size_t gap_count = shellGaps(sequence, list->size, gaps);
+    void** data = list->data;
+
+    for (size_t g = gap_count; g-- > 0;) {
+        size_t gap = gaps[g];
+        GraphStats_beginPass(stats, (long) gap);
+        for (size_t i = gap; i < list->size; i++) {
+            void* key = data[i];
+            GraphStats_incrementReads(stats, 1);
+            size_t j = i;
+            while (j >= gap) {
+                void* previous = data[j - gap];
+                GraphStats_incrementComparisons(stats);
+                GraphStats_incrementReads(stats, 1);
+                if (compare_func(previous, key) <= 0) break;
+                SDL_LockMutex(gm);
+                data[j] = previous;
+                GraphStats_incrementSwaps(stats);
+                GraphStats_incrementWrites(stats, 1);
+                SDL_UnlockMutex(gm);
+                if (delay_func) {
+                    delay_func(mainframe, column_graph, previous, key);
+                }
+                j -= gap;
+            }
+            if (j == i) continue;
+            SDL_LockMutex(gm);
+            data[j] = key;
+            GraphStats_incrementWrites(stats, 1);
+            SDL_UnlockMutex(gm);
+            if (delay_func) {
+                delay_func(mainframe, column_graph, key, NULL);
+            }
+        }
+        GraphStats_endPass(stats);
+    }
+
+    if (!stats) return;
+    log_message(LOG_LEVEL_INFO, "Shell sort (%s gaps) of %zu elements in %zu passes",
+                ShellGapSequence_toString(sequence), list->size, gap_count);
+    for (int i = 0; i < GraphStats_getPassCount(stats); i++) {
+        const GraphStatsPass* pass = GraphStats_getPass(stats, i);
+        log_message(LOG_LEVEL_INFO, "  gap %ld: %d comparisons, %d moves, %d reads, %d writes",
+                    pass->gap, pass->comparisons, pass->swaps, pass->reads, pass->writes);
+    }
+}
+
+void Vector_sortCounting(Vector* list, CompareFunc compare_func, SDL_mutex* gm, DelayFunc delay_func, MainFrame* mainframe, ColumnGraph* column_graph) {
+    if (column_graph && column_graph->type != GRAPH_TYPE_INT) {
+        log_message(LOG_LEVEL_WARN, "Counting sort only supports integer lists.");
+        return;
+    }
+    if (!list || list->size < 2) return;
+    UNUSED(compare_func);
+
+    GraphStats* stats = column_graph ? column_graph->stats : NULL;
+    void** data = list->data;
+    size_t size = list->size;
+    long min = (long) ((ColumnGraphBar*) data[0])->value;
+    long max = min;
+    for (size_t i = 1; i < size; i++) {
+        long value = (long) ((ColumnGraphBar*) data[i])->value;
+        if (value < min) min = value;
+        if (value > max) max = value;
+    }
+    GraphStats_incrementReads(stats, (int) size);
+
+    // Unsigned so that the range of any two longs fits.
+    unsigned long range = (unsigned long) max - (unsigned long) min;
+    // A wide range is counted SORT_COUNTING_RADIX_BITS at a time instead, each pass
+    // being a stable counting sort on one digit of value - min, so the histogram
+    // stays small and outliers cannot make the sort quadratic.
+    bool direct = range / SORT_COUNTING_RANGE_FACTOR < size;
+    int digit_bits = direct ? (int) sizeof(unsigned long) * 8 : SORT_COUNTING_RADIX_BITS;
+    size_t slots = direct ? (size_t) range + 1 : (size_t) 1 << SORT_COUNTING_RADIX_BITS;
+    unsigned long mask = direct ? ~0UL : slots - 1;
+
+    size_t* counts = malloc((slots + 1) * sizeof(size_t));
+    void** output = malloc(size * sizeof(void*));
+    if (!counts || !output) {
+        error("Failed to allocate memory for counting sort");
+        free(counts);
+        free(output);
+        return;
+    }
+    GraphStats_allocAux(stats, (slots + 1) * sizeof(size_t) + size * sizeof(void*));
+
+    int shift = 0;
+    do {
+        memset(counts, 0, (slots + 1) * sizeof(size_t));
+        for (size_t i = 0; i < size; i++) {
+            counts[(((unsigned long) (long) ((ColumnGraphBar*) data[i])->value - (unsigned long) min) >> shift & mask) + 1]++;
+        }
+        for (size_t i = 1; i <= slots; i++) {
+            counts[i] += counts[i - 1];
+        }
+        // counts[s] is now where slot s starts, the scatter leaves it where slot s + 1 starts.
+        for (size_t i = 0; i < size; i++) {
+            void* bar = data[i];
+            output[counts[((unsigned long) (long) ((ColumnGraphBar*) bar)->value - (unsigned long) min) >> shift & mask]++] = bar;
+        }
+        GraphStats_incrementReads(stats, (int) (size + slots));
+        GraphStats_incrementWrites(stats, (int) size);
+
+        for (size_t i = 0; i < size; i++) {
+            SDL_LockMutex(gm);
+            data[i] = output[i];
+            GraphStats_incrementWrites(stats, 1);
+            SDL_UnlockMutex(gm);
+            if (delay_func) {
+                delay_func(mainframe, column_graph, data[i], NULL);
+            }
+        }
+        shift += digit_bits;
+    } while (!direct && shift < (int) sizeof(unsigned long) * 8 && range >> shift > 0);
+
+    free(counts);
+    free(output);
+    GraphStats_freeAux(stats, (slots + 1) * sizeof(size_t) + size * sizeof(void*));
+}
+
+// Level 0 keys a bar by its length, level l > 0 by its character l - 1.
+static size_t msdKey(void* bar, size_t level, GraphStats* stats) {
+    const char* str = ((ColumnGraphBar*) bar)->value;
+    if (level > 0) {
+        GraphStats_incrementReads(stats, 1);
+        return (unsigned char) str[level - 1];
+    }
+    size_t length = strlen(str);
+    GraphStats_incrementReads(stats, (int) length + 1);
+    return length;
+}
+
+// Insertion sort of bars of the same length which share their first from characters,
+// finishes the small buckets of both string radix sorts.
+static void msdInsertion(void** data, size_t start, size_t end, size_t from, SDL_mutex* gm, DelayFunc delay_func, MainFrame* mainframe, ColumnGraph* column_graph) {
+    GraphStats* stats = column_graph ? column_graph->stats : NULL;
+    for (size_t i = start + 1; i < end; i++) {
+        void* key = data[i];
+        const char* key_str = ((ColumnGraphBar*) key)->value;
+        size_t j = i;
+        while (j > start) {
+            const char* str = ((ColumnGraphBar*) data[j - 1])->value;
+            size_t c = from;
+            while (str[c] && str[c] == key_str[c]) c++;
+            GraphStats_incrementComparisons(stats);
+            GraphStats_incrementReads(stats, (int) (2 * (c - from + 1)));
+            if ((unsigned char) str[c] <= (unsigned char) key_str[c]) break;
+            SDL_LockMutex(gm);
+            data[j] = data[j - 1];
+            GraphStats_incrementSwaps(stats);
+            GraphStats_incrementWrites(stats, 1);
+            SDL_UnlockMutex(gm);
+            if (delay_func) {
+                delay_func(mainframe, column_graph, data[j], key);
+            }
+            j--;
+        }
+        if (j == i) continue;
+        SDL_LockMutex(gm);
+        data[j] = key;
+        GraphStats_incrementWrites(stats, 1);
+        SDL_UnlockMutex(gm);
+        if (delay_func) {
+            delay_func(mainframe, column_graph, key, NULL);
+        }
+    }
+}
+
+// American flag pass: counts the keys of [start, end) then cycles every bar into its bucket.
+// next[b] ends up where bucket b ends, first[b] is where it starts.
+static void msdPermute(void** data, size_t start, size_t end, size_t level, size_t buckets, size_t* first, size_t* next, SDL_mutex* gm, DelayFunc delay_func, MainFrame* mainframe, ColumnGraph* column_graph) {
+    GraphStats* stats = column_graph ? column_graph->stats : NULL;
+    memset(next, 0, buckets * sizeof(size_t));
+    for (size_t i = start; i < end; i++) {
+        next[msdKey(data[i], level, stats)]++;
+    }
+    size_t offset = start;
+    for (size_t b = 0; b < buckets; b++) {
+        first[b] = offset;
+        offset += next[b];
+        next[b] = first[b];
+    }
+    for (size_t b = 0; b < buckets; b++) {
+        size_t bucket_end = b + 1 < buckets ? first[b + 1] : end;
+        while (next[b] < bucket_end) {
+            size_t key = msdKey(data[next[b]], level, stats);
+            if (key == b) {
+                next[b]++;
+                continue;
+            }
+            size_t target = next[key]++;
+            void* a = data[next[b]];
+            void* other = data[target];
+            SDL_LockMutex(gm);
+            data[next[b]] = other;
+            data[target] = a;
+            GraphStats_incrementSwaps(stats);
+            GraphStats_incrementReads(stats, 1);
+            GraphStats_incrementWrites(stats, 2);
+            SDL_UnlockMutex(gm);
+            if (delay_func) {
+                delay_func(mainframe, column_graph, a, other);
+            }
+        }
+    }
+}
+
+// Pending buckets are (start, end, level, length) quadruples.
+static bool msdPush(size_t** stack, size_t* size, size_t* capacity, size_t start, size_t end, size_t level, size_t length, GraphStats* stats) {
+    if (*size + 4 > *capacity) {
+        size_t* grown = realloc(*stack, 2 * *capacity * sizeof(size_t));
+        if (!grown) {
+            error("Failed to allocate memory for MSD radix sort");
+            return false;
+        }
+        GraphStats_allocAux(stats, *capacity * sizeof(size_t));
+        *stack = grown;
+        *capacity *= 2;
+    }
+    (*stack)[(*size)++] = start;
+    (*stack)[(*size)++] = end;
+    (*stack)[(*size)++] = level;
+    (*stack)[(*size)++] = length;
+    return true;
+}
+
+void Vector_sortMsdRadix(Vector* list, CompareFunc compare_func, SDL_mutex* gm, DelayFunc delay_func, MainFrame* mainframe, ColumnGraph* column_graph) {
+    if (column_graph && column_graph->type == GRAPH_TYPE_INT) {
+        Vector_sortRadix(list, compare_func, gm, delay_func, mainframe, column_graph);
+        return;
+    }
+    if (!list || list->size < 2) return;
+
+    GraphStats* stats = column_graph ? column_graph->stats : NULL;
+    void** data = list->data;
+    size_t max_length = 0;
+    for (size_t i = 0; i < list->size; i++) {
+        size_t length = msdKey(data[i], 0, stats);
+        if (length > max_length) max_length = length;
+    }
+
+    size_t* first = malloc((max_length + 1) * sizeof(size_t));
+    size_t* next = malloc((max_length + 1) * sizeof(size_t));
+    // Buckets left to sort, taken last in first out.
+    size_t stack_capacity = 4 * 256;
+    size_t* stack = malloc(stack_capacity * sizeof(size_t));
+    if (!first || !next || !stack) {
+        error("Failed to allocate memory for MSD radix sort");
+        free(first);
+        free(next);
+        free(stack);
+        return;
+    }
+    size_t stack_size = 0;
+    GraphStats_allocAux(stats, 2 * (max_length + 1) * sizeof(size_t) + stack_capacity * sizeof(size_t));
+
+    msdPermute(data, 0, list->size, 0, max_length + 1, first, next, gm, delay_func, mainframe, column_graph);
+    for (size_t length = 1; length <= max_length; length++) {
+        size_t start = first[length];
+        size_t end = next[length];
+        if (end - start < 2) continue;
+        if (!msdPush(&stack, &stack_size, &stack_capacity, start, end, 1, length, stats)) {
+            free(first);
+            free(next);
+            free(stack);
+            GraphStats_freeAux(stats, 2 * (max_length + 1) * sizeof(size_t) + stack_capacity * sizeof(size_t));
+            return;
+        }
+    }
+    free(first);
+    free(next);
+    GraphStats_freeAux(stats, 2 * (max_length + 1) * sizeof(size_t));
+
+    size_t char_first[256];
+    size_t char_next[256];
+    while (stack_size > 0) {
+        size_t length = stack[--stack_size];
+        size_t level = stack[--stack_size];
+        size_t end = stack[--stack_size];
+        size_t start = stack[--stack_size];
+        if (end - start < SORT_MSD_INSERTION_THRESHOLD) {
+            msdInsertion(data, start, end, level - 1, gm, delay_func, mainframe, column_graph);
+            continue;
+        }
+        msdPermute(data, start, end, level, 256, char_first, char_next, gm, delay_func, mainframe, column_graph);
+        if (level == length) continue;
+        for (size_t b = 0; b < 256; b++) {
+            if (char_next[b] - char_first[b] < 2) continue;
+            if (!msdPush(&stack, &stack_size, &stack_capacity, char_first[b], char_next[b], level + 1, length, stats)) {
+                free(stack);
+                GraphStats_freeAux(stats, stack_capacity * sizeof(size_t));
+                return;
+            }
+        }
+    }
+    free(stack);
+    GraphStats_freeAux(stats, stack_capacity * sizeof(size_t));
+}
+
+// Swaps two bars under the graph mutex, for the sorts working straight on the data array.
+static void sortSwap(void** data, size_t i, size_t j, SDL_mutex* gm, DelayFunc delay_func, MainFrame* mainframe, ColumnGraph* column_graph) {
+    if (i == j) return;
+    void* a = data[i];
+    void* b = data[j];
+    SDL_LockMutex(gm);
+    data[i] = b;
+    data[j] = a;
+    if (column_graph && column_graph->stats) {
+        GraphStats_incrementSwaps(column_graph->stats);
+        GraphStats_incrementReads(column_graph->stats, 1);
+        GraphStats_incrementWrites(column_graph->stats, 2);
+    }
+    SDL_UnlockMutex(gm);
+    if (delay_func) {
+        delay_func(mainframe, column_graph, a, b);
+    }
+}
+
+// Sorts [start, end) whose bars share their keys below level (see msdKey), length being
+// their common length once level > 0. Recurses on the smaller and greater parts and loops
+// on the equal one.
+static void multikeyQuickRec(void** data, size_t start, size_t end, size_t level, size_t length, SDL_mutex* gm, DelayFunc delay_func, MainFrame* mainframe, ColumnGraph* column_graph) {
+    GraphStats* stats = column_graph ? column_graph->stats : NULL;
+    while (end - start > 1 && (level == 0 || level <= length)) {
+        if (level > 0 && end - start < SORT_MULTIKEY_INSERTION_THRESHOLD) {
+            msdInsertion(data, start, end, level - 1, gm, delay_func, mainframe, column_graph);
+            return;
+        }
+
+        size_t a = msdKey(data[start], level, stats);
+        size_t b = msdKey(data[start + (end - start) / 2], level, stats);
+        size_t c = msdKey(data[end - 1], level, stats);
+        size_t pivot = a < b ? (b < c ? b : (a < c ? c : a)) : (a < c ? a : (b < c ? c : b));
+
+        size_t lt = start;
+        size_t i = start;
+        size_t gt = end;
+        while (i < gt) {
+            size_t key = msdKey(data[i], level, stats);
+            // Only the three-way test against the pivot counts, not the median-of-3 fetches above.
+            GraphStats_incrementCharComparisons(stats);
+            if (key < pivot) {
+                sortSwap(data, lt++, i++, gm, delay_func, mainframe, column_graph);
+            } else if (key > pivot) {
+                sortSwap(data, i, --gt, gm, delay_func, mainframe, column_graph);
+            } else {
+                i++;
+            }
+        }
+        multikeyQuickRec(data, start, lt, level, length, gm, delay_func, mainframe, column_graph);
+        multikeyQuickRec(data, gt, end, level, length, gm, delay_func, mainframe, column_graph);
+
+        if (level == 0) {
+            length = pivot;
+        }
+        start = lt;
+        end = gt;
+        level++;
+    }
+}
+
+void Vector_sortMultikeyQuick(Vector* list, CompareFunc compare_func, SDL_mutex* gm, DelayFunc delay_func, MainFrame* mainframe, ColumnGraph* column_graph) {
+    if (column_graph && column_graph->type == GRAPH_TYPE_INT) {
+        Vector_sortQuick(list, compare_func, gm, delay_func, mainframe, column_graph);
+        return;
+    }
+    if (!list || list->size < 2) return;
+
+    multikeyQuickRec(list->data, 0, list->size, 0, 0, gm, delay_func, mainframe, column_graph);
+    if (column_graph && column_graph->stats) {
+        log_message(LOG_LEVEL_DEBUG, "Multikey quicksort of %zu strings: %d character comparisons, %d string comparisons",
+                    list->size, GraphStats_getCharComparisons(column_graph->stats),
+                    GraphStats_getComparisons(column_graph->stats));
+    }
+}
+
+// State shared by the block merge helpers. The internal buffer and the keys live inside
+// the array, so this is all the extra memory the sort uses.
+typedef struct {
+    void** data;
+    CompareFunc compare_func;
+    SDL_mutex* gm;
+    DelayFunc delay_func;
+    MainFrame* mainframe;
+    ColumnGraph* column_graph;
+} BlockMerge;
+
+static int blockMergeCompare(BlockMerge* bm, ptrdiff_t i, ptrdiff_t j) {
+    if (bm->column_graph && bm->column_graph->stats) {
+        GraphStats_incrementComparisons(bm->column_graph->stats);
+        GraphStats_incrementReads(bm->column_graph->stats, 2);
+    }
+    return bm->compare_func(bm->data[i], bm->data[j]);
+}
+
+// Whether data[i] goes before data[j], equal elements included when left_first is set.
+static bool blockMergeBefore(BlockMerge* bm, ptrdiff_t i, ptrdiff_t j, bool left_first) {
+    int c = blockMergeCompare(bm, i, j);
+    return left_first ? c <= 0 : c < 0;
+}
+
+static void blockMergeSwap(BlockMerge* bm, ptrdiff_t i, ptrdiff_t j) {
+    sortSwap(bm->data, (size_t) i, (size_t) j, bm->gm, bm->delay_func, bm->mainframe, bm->column_graph);
+}
+
+static void blockMergeSwapN(BlockMerge* bm, ptrdiff_t a, ptrdiff_t b, ptrdiff_t n) {
+    for (ptrdiff_t k = 0; k < n; k++) {
+        blockMergeSwap(bm, a + k, b + k);
+    }
+}
+
+// Turns the adjacent blocks [a, a + l1) and [a + l1, a + l1 + l2) around.
+static void blockMergeRotate(BlockMerge* bm, ptrdiff_t a, ptrdiff_t l1, ptrdiff_t l2) {
+    while (l1 && l2) {
+        if (l1 <= l2) {
+            blockMergeSwapN(bm, a, a + l1, l1);
+            a += l1;
+            l2 -= l1;
+        } else {
+            blockMergeSwapN(bm, a + (l1 - l2), a + l1, l2);
+            l1 -= l2;
+        }
+    }
+}
+
+// First index of [a, a + len) not smaller than data[key] (left) or greater than it (right).
+static ptrdiff_t blockMergeSearch(BlockMerge* bm, ptrdiff_t a, ptrdiff_t len, ptrdiff_t key, bool right) {
+    ptrdiff_t low = -1;
+    ptrdiff_t high = len;
+    while (low < high - 1) {
+        ptrdiff_t mid = low + (high - low) / 2;
+        int c = blockMergeCompare(bm, a + mid, key);
+        if (right ? c > 0 : c >= 0) {
+            high = mid;
+        } else {
+            low = mid;
+        }
+    }
+    return high;
+}
+
+static void blockMergeInsertion(BlockMerge* bm, ptrdiff_t a, ptrdiff_t len) {
+    for (ptrdiff_t i = 1; i < len; i++) {
+        for (ptrdiff_t j = i - 1; j >= 0 && blockMergeCompare(bm, a + j + 1, a + j) < 0; j--) {
+            blockMergeSwap(bm, a + j, a + j + 1);
+        }
+    }
+}
+
+// Moves the first distinct values of [a, a + len) to its front, sorted, and returns how many
+// were found (at most wanted). They serve as the internal buffer and as block tags.
+static ptrdiff_t blockMergeFindKeys(BlockMerge* bm, ptrdiff_t a, ptrdiff_t len, ptrdiff_t wanted) {
+    ptrdiff_t found = 1;
+    ptrdiff_t keys = 0;
+    for (ptrdiff_t u = 1; u < len && found < wanted; u++) {
+        ptrdiff_t r = blockMergeSearch(bm, a + keys, found, a + u, false);
+        if (r == found || blockMergeCompare(bm, a + u, a + keys + r) != 0) {
+            // The keys roll along the array next to the new one, then take it in at its rank.
+            blockMergeRotate(bm, a + keys, found, u - (keys + found));
+            keys = u - found;
+            blockMergeRotate(bm, a + keys + r, found - r, 1);
+            found++;
+        }
+    }
+    blockMergeRotate(bm, a, keys, found);
+    return found;
+}
+
+// Stable merge of [a, a + len1) and the following len2 elements with rotations only.
+static void blockMergeWithoutBuffer(BlockMerge* bm, ptrdiff_t a, ptrdiff_t len1, ptrdiff_t len2) {
+    if (len1 < len2) {
+        while (len1) {
+            ptrdiff_t h = blockMergeSearch(bm, a + len1, len2, a, false);
+            if (h) {
+                blockMergeRotate(bm, a, len1, h);
+                a += h;
+                len2 -= h;
+            }
+            if (!len2) break;
+            do {
+                a++;
+                len1--;
+            } while (len1 && blockMergeCompare(bm, a, a + len1) <= 0);
+        }
+    } else {
+        while (len2) {
+            ptrdiff_t h = blockMergeSearch(bm, a, len1, a + len1 + len2 - 1, true);
+            if (h != len1) {
+                blockMergeRotate(bm, a + h, len1 - h, len2);
+                len1 = h;
+            }
+            if (!len1) break;
+            do {
+                len2--;
+            } while (len2 && blockMergeCompare(bm, a + len1 - 1, a + len1 + len2 - 1) <= 0);
+        }
+    }
+}
+
+// Merges [a, a + l1) and the following l2 elements into the buffer starting at a + buffer
+// (buffer < 0), the buffer ending up after the merged run.
+static void blockMergeLeft(BlockMerge* bm, ptrdiff_t a, ptrdiff_t l1, ptrdiff_t l2, ptrdiff_t buffer) {
+    ptrdiff_t p0 = 0;
+    ptrdiff_t p1 = l1;
+    l2 += l1;
+    while (p1 < l2) {
+        if (p0 == l1 || blockMergeCompare(bm, a + p0, a + p1) > 0) {
+            blockMergeSwap(bm, a + buffer++, a + p1++);
+        } else {
+            blockMergeSwap(bm, a + buffer++, a + p0++);
+        }
+    }
+    if (buffer != p0) {
+        blockMergeSwapN(bm, a + buffer, a + p0, l1 - p0);
+    }
+}
+
+// Mirror of blockMergeLeft: the buffer of length buffer follows the two runs and ends up before them.
+static void blockMergeRight(BlockMerge* bm, ptrdiff_t a, ptrdiff_t l1, ptrdiff_t l2, ptrdiff_t buffer) {
+    ptrdiff_t p0 = l1 + l2 + buffer - 1;
+    ptrdiff_t p2 = l1 + l2 - 1;
+    ptrdiff_t p1 = l1 - 1;
+    while (p1 >= 0) {
+        if (p2 < l1 || blockMergeCompare(bm, a + p1, a + p2) > 0) {
+            blockMergeSwap(bm, a + p0--, a + p1--);
+        } else {
+            blockMergeSwap(bm, a + p0--, a + p2--);
+        }
+    }
+    if (p2 != p0) {
+        while (p2 >= l1) {
+            blockMergeSwap(bm, a + p0--, a + p2--);
+        }
+    }
+}
+
+// Merges the rest of a run (*len1 elements of origin *origin, 0 for the left run) with the
+// next block of len2 through the buffer before a. Leaves the unmerged tail in *len1/*origin.
+static void blockMergeSmartWithBuffer(BlockMerge* bm, ptrdiff_t a, ptrdiff_t* len1, int* origin, ptrdiff_t len2, ptrdiff_t buffer) {
+    ptrdiff_t p0 = -buffer;
+    ptrdiff_t p1 = 0;
+    ptrdiff_t p2 = *len1;
+    ptrdiff_t q1 = p2;
+    ptrdiff_t q2 = p2 + len2;
+    int next = 1 - *origin;
+    while (p1 < q1 && p2 < q2) {
+        if (blockMergeBefore(bm, a + p1, a + p2, next)) {
+            blockMergeSwap(bm, a + p0++, a + p1++);
+        } else {
+            blockMergeSwap(bm, a + p0++, a + p2++);
+        }
+    }
+    if (p1 < q1) {
+        *len1 = q1 - p1;
+        while (p1 < q1) {
+            blockMergeSwap(bm, a + --q1, a + --q2);
+        }
+    } else {
+        *len1 = q2 - p2;
+        *origin = next;
+    }
+}
+
+// Same as blockMergeSmartWithBuffer when no buffer is left, with rotations.
+static void blockMergeSmartWithoutBuffer(BlockMerge* bm, ptrdiff_t a, ptrdiff_t* len1, int* origin, ptrdiff_t len2) {
+    if (!len2) return;
+    ptrdiff_t l1 = *len1;
+    int next = 1 - *origin;
+    if (l1 && !blockMergeBefore(bm, a + l1 - 1, a + l1, next)) {
+        while (l1) {
+            ptrdiff_t h = blockMergeSearch(bm, a + l1, len2, a, !next);
+            if (h) {
+                blockMergeRotate(bm, a, l1, h);
+                a += h;
+                len2 -= h;
+            }
+            if (!len2) {
+                *len1 = l1;
+                return;
+            }
+            do {
+                a++;
+                l1--;
+            } while (l1 && blockMergeBefore(bm, a, a + l1, next));
+        }
+    }
+    *len1 = len2;
+    *origin = next;
+}
+
+// Merges the blocks of [a, ...) once sorted by first element, keys telling which run each
+// block came from (smaller than mid_key: left run), followed by last_blocks blocks and a
+// last_length tail of the right run.
+static void blockMergeBlocks(BlockMerge* bm, ptrdiff_t keys, ptrdiff_t mid_key, ptrdiff_t a, ptrdiff_t block_count, ptrdiff_t block, bool buffered, ptrdiff_t last_blocks, ptrdiff_t last_length) {
+    if (block_count == 0) {
+        ptrdiff_t length = last_blocks * block;
+        if (buffered) {
+            blockMergeLeft(bm, a, length, last_length, -block);
+        } else {
+            blockMergeWithoutBuffer(bm, a, length, last_length);
+        }
+        return;
+    }
+
+    ptrdiff_t rest = block;
+    int origin = blockMergeCompare(bm, keys, mid_key) < 0 ? 0 : 1;
+    ptrdiff_t index = block;
+    for (ptrdiff_t k = 1; k < block_count; k++, index += block) {
+        ptrdiff_t rest_start = index - rest;
+        int next = blockMergeCompare(bm, keys + k, mid_key) < 0 ? 0 : 1;
+        if (next == origin) {
+            if (buffered) {
+                blockMergeSwapN(bm, a + rest_start - block, a + rest_start, rest);
+            }
+            rest = block;
+        } else if (buffered) {
+            blockMergeSmartWithBuffer(bm, a + rest_start, &rest, &origin, block, block);
+        } else {
+            blockMergeSmartWithoutBuffer(bm, a + rest_start, &rest, &origin, block);
+        }
+    }
+    ptrdiff_t rest_start = index - rest;
+    if (last_length) {
+        if (origin) {
+            if (buffered) {
+                blockMergeSwapN(bm, a + rest_start - block, a + rest_start, rest);
+            }
+            rest_start = index;
+            rest = block * last_blocks;
+        } else {
+            rest += block * last_blocks;
+        }
+        if (buffered) {
+            blockMergeLeft(bm, a + rest_start, rest, last_length, -block);
+        } else {
+            blockMergeWithoutBuffer(bm, a + rest_start, rest, last_length);
+        }
+    } else if (buffered) {
+        blockMergeSwapN(bm, a + rest_start, a + rest_start - block, rest);
+    }
+}
+
+// Sorts [a, a + len) into runs of 2 * buffer, the buffer being the buffer elements before a.
+static void blockMergeBuildRuns(BlockMerge* bm, ptrdiff_t a, ptrdiff_t len, ptrdiff_t buffer) {
+    // Pairs are sorted while moved two places left, into the buffer.
+    for (ptrdiff_t m = 1; m < len; m += 2) {
+        ptrdiff_t u = blockMergeCompare(bm, a + m - 1, a + m) > 0 ? 1 : 0;
+        blockMergeSwap(bm, a + m - 3, a + m - 1 + u);
+        blockMergeSwap(bm, a + m - 2, a + m - u);
+    }
+    if (len % 2) {
+        blockMergeSwap(bm, a + len - 1, a + len - 3);
+    }
+    a -= 2;
+    for (ptrdiff_t h = 2; h < buffer; h *= 2) {
+        ptrdiff_t p0 = 0;
+        for (; p0 <= len - 2 * h; p0 += 2 * h) {
+            blockMergeLeft(bm, a + p0, h, h, -h);
+        }
+        ptrdiff_t rest = len - p0;
+        if (rest > h) {
+            blockMergeLeft(bm, a + p0, h, rest - h, -h);
+        } else {
+            blockMergeRotate(bm, a + p0 - h, h, rest);
+        }
+        a -= h;
+    }
+    // The runs now sit buffer places left: merging from the right moves them back.
+    ptrdiff_t rest = len % (2 * buffer);
+    ptrdiff_t p = len - rest;
+    if (rest <= buffer) {
+        blockMergeRotate(bm, a + p, rest, buffer);
+    } else {
+        blockMergeRight(bm, a + p, buffer, rest - buffer, buffer);
+    }
+    while (p > 0) {
+        p -= 2 * buffer;
+        blockMergeRight(bm, a + p, buffer, buffer, buffer);
+    }
+}
+
+// Merges each pair of run_length runs of [a, a + len): the blocks of both runs are selection
+// sorted by first element (keys break ties so that the left run stays first), then merged
+// block by block.
+static void blockMergeCombine(BlockMerge* bm, ptrdiff_t keys, ptrdiff_t a, ptrdiff_t len, ptrdiff_t run_length, ptrdiff_t block, bool buffered) {
+    ptrdiff_t pairs = len / (2 * run_length);
+    ptrdiff_t rest = len % (2 * run_length);
+    if (rest <= run_length) {
+        // A lone last run is already sorted.
+        len -= rest;
+        rest = 0;
+    }
+    for (ptrdiff_t b = 0; b <= pairs; b++) {
+        if (b == pairs && rest == 0) break;
+        ptrdiff_t start = a + b * 2 * run_length;
+        ptrdiff_t block_count = (b == pairs ? rest : 2 * run_length) / block;
+        blockMergeInsertion(bm, keys, block_count + (b == pairs ? 1 : 0));
+        ptrdiff_t mid_key = run_length / block;
+        for (ptrdiff_t u = 1; u < block_count; u++) {
+            ptrdiff_t min = u - 1;
+            for (ptrdiff_t v = u; v < block_count; v++) {
+                int c = blockMergeCompare(bm, start + min * block, start + v * block);
+                if (c > 0 || (c == 0 && blockMergeCompare(bm, keys + min, keys + v) > 0)) {
+                    min = v;
+                }
+            }
+            if (min != u - 1) {
+                blockMergeSwapN(bm, start + (u - 1) * block, start + min * block, block);
+                blockMergeSwap(bm, keys + u - 1, keys + min);
+                if (mid_key == u - 1 || mid_key == min) {
+                    mid_key ^= (u - 1) ^ min;
+                }
+            }
+        }
+        ptrdiff_t last_blocks = 0;
+        ptrdiff_t last_length = b == pairs ? rest % block : 0;
+        if (last_length) {
+            while (last_blocks < block_count
+                   && blockMergeCompare(bm, start + block_count * block, start + (block_count - last_blocks - 1) * block) < 0) {
+                last_blocks++;
+            }
+        }
+        blockMergeBlocks(bm, keys, keys + mid_key, start, block_count - last_blocks, block, buffered, last_blocks, last_length);
+    }
+    if (buffered) {
+        // The merged runs ended up one block left, bring them back after the buffer.
+        while (--len >= 0) {
+            blockMergeSwap(bm, a + len, a + len - block);
+        }
+    }
+}
+
+// Bottom-up merge with rotations, for lists with too few distinct values to build a buffer.
+static void blockMergeLazy(BlockMerge* bm, ptrdiff_t a, ptrdiff_t len) {
+    for (ptrdiff_t m = 1; m < len; m += 2) {
+        if (blockMergeCompare(bm, a + m - 1, a + m) > 0) {
+            blockMergeSwap(bm, a + m - 1, a + m);
+        }
+    }
+    for (ptrdiff_t h = 2; h < len; h *= 2) {
+        ptrdiff_t p0 = 0;
+        for (; p0 <= len - 2 * h; p0 += 2 * h) {
+            blockMergeWithoutBuffer(bm, a + p0, h, h);
+        }
+        ptrdiff_t rest = len - p0;
+        if (rest > h) {
+            blockMergeWithoutBuffer(bm, a + p0, h, rest - h);
+        }
+    }
+}
+
+void Vector_sortBlockMerge(Vector* list, CompareFunc compare_func, SDL_mutex* gm, DelayFunc delay_func, MainFrame* mainframe, ColumnGraph* column_graph) {
+    if (!list || list->size < 2) return;
+    if (!compare_func) {
+        compare_func = Vector_defaultCompare;
+    }
+
+    GraphStats* stats = column_graph ? column_graph->stats : NULL;
+    BlockMerge bm = {list->data, compare_func, gm, delay_func, mainframe, column_graph};
+    GraphStats_allocAux(stats, sizeof(BlockMerge));
+    ptrdiff_t len = (ptrdiff_t) list->size;
+    if (len < SORT_BLOCK_MERGE_INSERTION_THRESHOLD) {
+        blockMergeInsertion(&bm, 0, len);
+        GraphStats_freeAux(stats, sizeof(BlockMerge));
+        return;
+    }
+
+    // Blocks of about sqrt(n): one tag key per block, plus one block of buffer.
+    ptrdiff_t block = 1;
+    while (block * block < len) {
+        block *= 2;
+    }
+    ptrdiff_t key_count = (len - 1) / block + 1;
+    ptrdiff_t found = blockMergeFindKeys(&bm, 0, len, key_count + block);
+    bool buffered = true;
+    if (found < key_count + block) {
+        if (found < 4) {
+            blockMergeLazy(&bm, 0, len);
+            GraphStats_freeAux(stats, sizeof(BlockMerge));
+            return;
+        }
+        // Not enough distinct values for a full buffer: the keys double as a smaller one.
+        key_count = block;
+        while (key_count > found) {
+            key_count /= 2;
+        }
+        buffered = false;
+        block = 0;
+    }
+    ptrdiff_t start = block + key_count;
+    ptrdiff_t run_length = buffered ? block : key_count;
+    blockMergeBuildRuns(&bm, start, len - start, run_length);
+
+    while (len - start > (run_length *= 2)) {
+        ptrdiff_t merge_block = block;
+        bool merge_buffered = buffered;
+        if (!buffered) {
+            if (key_count > 4 && key_count / 8 * key_count >= run_length) {
+                merge_block = key_count / 2;
+                merge_buffered = true;
+            } else {
+                ptrdiff_t tags = 1;
+                long long s = (long long) run_length * found / 2;
+                while (tags < key_count && s != 0) {
+                    tags *= 2;
+                    s /= 8;
+                }
+                merge_block = 2 * run_length / tags;
             }
+        }
+        blockMergeCombine(&bm, 0, start, len - start, run_length, merge_block, merge_buffered);
+    }
+    // The keys and buffer are distinct values: sort them and merge them back.
+    blockMergeInsertion(&bm, 0, start);
+    blockMergeWithoutBuffer(&bm, 0, start, len - start);
+    GraphStats_freeAux(stats, sizeof(BlockMerge));
+}
+
+// Where item goes among data[start, size): start plus the number of smaller elements after start,
+// moved past the elements equal to it already there.
+static size_t cycleSortPosition(void** data, size_t start, size_t size, void* item, CompareFunc compare_func, GraphStats* stats) {
+    size_t pos = start;
+    for (size_t i = start + 1; i < size; i++) {
+        GraphStats_incrementComparisons(stats);
+        GraphStats_incrementReads(stats, 1);
+        if (compare_func(data[i], item) < 0) {
+            pos++;
+        }
+    }
+    if (pos == start) return pos;
+    while (true) {
+        GraphStats_incrementComparisons(stats);
+        GraphStats_incrementReads(stats, 1);
+        if (compare_func(data[pos], item) != 0) break;
+        pos++;
+    }
+    return pos;
+}
+
+void Vector_sortCycle(Vector* list, CompareFunc compare_func, SDL_mutex* gm, DelayFunc delay_func, MainFrame* mainframe, ColumnGraph* column_graph) {
+    if (!list || list->size < 2) return;
+    if (!compare_func) {
+        compare_func = Vector_defaultCompare;
+    }
+
+    GraphStats* stats = column_graph ? column_graph->stats : NULL;
+    void** data = list->data;
+    size_t size = list->size;
+    for (size_t start = 0; start + 1 < size; start++) {
+        void* item = data[start];
+        GraphStats_incrementReads(stats, 1);
+        size_t pos = cycleSortPosition(data, start, size, item, compare_func, stats);
+        // The slot at start keeps its old bar until the bar that belongs there closes the cycle.
+        while (pos != start) {
+            void* displaced = data[pos];
+            SDL_LockMutex(gm);
+            data[pos] = item;
+            GraphStats_incrementSwaps(stats);
+            GraphStats_incrementWrites(stats, 1);
             SDL_UnlockMutex(gm);
             if (delay_func) {
-                delay_func(mainframe, column_graph, List_get(list, i), NULL);
+                delay_func(mainframe, column_graph, item, displaced);
+            }
+            item = displaced;
+            pos = cycleSortPosition(data, start, size, item, compare_func, stats);
+        }
+        if (item != data[start]) {
+            SDL_LockMutex(gm);
+            data[start] = item;
+            GraphStats_incrementSwaps(stats);
+            GraphStats_incrementWrites(stats, 1);
+            SDL_UnlockMutex(gm);
+            if (delay_func) {
+                delay_func(mainframe, column_graph, item, NULL);
             }
         }
-        List_destroy(output);
     }
 }
 
-void List_sort(List* list, ListSortType sortType, CompareFunc compare_func, SDL_mutex* gm, DelayFunc delay_func , MainFrame* mainframe, ColumnGraph* column_graph) {
+void Vector_sort(Vector* list, ListSortType sortType, CompareFunc compare_func, SDL_mutex* gm, DelayFunc delay_func , MainFrame* mainframe, ColumnGraph* column_graph) {
     switch (sortType) {
         case LIST_SORT_TYPE_BUBBLE:
-            List_sortBubble(list, compare_func, gm, delay_func, mainframe, column_graph);
+            Vector_sortBubble(list, compare_func, gm, delay_func, mainframe, column_graph);
             break;
         case LIST_SORT_TYPE_QUICK:
-            List_sortQuick(list, compare_func, gm, delay_func, mainframe, column_graph);
+            Vector_sortQuick(list, compare_func, gm, delay_func, mainframe, column_graph);
             break;
         case LIST_SORT_TYPE_MERGE:
-            List_sortMerge(list, compare_func, gm, delay_func, mainframe, column_graph);
+            Vector_sortMerge(list, compare_func, gm, delay_func, mainframe, column_graph);
             break;
         case LIST_SORT_TYPE_INSERTION:
-            List_sortInsertion(list, compare_func, gm, delay_func, mainframe, column_graph);
+            Vector_sortInsertion(list, compare_func, gm, delay_func, mainframe, column_graph);
             break;
         case LIST_SORT_TYPE_BITONIC:
-            List_sortBitonic(list, compare_func, gm, delay_func, mainframe, column_graph);
+            Vector_sortBitonic(list, compare_func, gm, delay_func, mainframe, column_graph);
             break;
         case LIST_SORT_TYPE_BOGO:
-            List_sortBogo(list, compare_func, gm, delay_func, mainframe, column_graph);
+            Vector_sortBogo(list, compare_func, gm, delay_func, mainframe, column_graph);
             break;
         case LIST_SORT_TYPE_SELECTION:
-            List_sortSelection(list, compare_func, gm, delay_func, mainframe, column_graph);
+            Vector_sortSelection(list, compare_func, gm, delay_func, mainframe, column_graph);
             break;
         case LIST_SORT_TYPE_RADIX:
-            List_sortRadix(list, compare_func, gm, delay_func, mainframe, column_graph);
+            Vector_sortRadix(list, compare_func, gm, delay_func, mainframe, column_graph);
+            break;
+        case LIST_SORT_TYPE_HEAP:
+            Vector_sortHeap(list, compare_func, gm, delay_func, mainframe, column_graph);
+            break;
+        case LIST_SORT_TYPE_HEAP_QUATERNARY:
+            Vector_sortHeapQuaternary(list, compare_func, gm, delay_func, mainframe, column_graph);
+            break;
+        case LIST_SORT_TYPE_SHELL:
+            Vector_sortShell(list, compare_func, gm, delay_func, mainframe, column_graph);
+            break;
+        case LIST_SORT_TYPE_COUNTING:
+            Vector_sortCounting(list, compare_func, gm, delay_func, mainframe, column_graph);
+            break;
+        case LIST_SORT_TYPE_MSD_RADIX:
+            Vector_sortMsdRadix(list, compare_func, gm, delay_func, mainframe, column_graph);
+            break;
+        case LIST_SORT_TYPE_MULTIKEY_QUICK:
+            Vector_sortMultikeyQuick(list, compare_func, gm, delay_func, mainframe, column_graph);
+            break;
+        case LIST_SORT_TYPE_BLOCK_MERGE:
+            Vector_sortBlockMerge(list, compare_func, gm, delay_func, mainframe, column_graph);
+            break;
+        case LIST_SORT_TYPE_SAMPLE:
+            Vector_sortSample(list, compare_func, gm, delay_func, mainframe, column_graph);
+            break;
+        case LIST_SORT_TYPE_PARALLEL_QUICK:
+            Vector_sortParallelQuick(list, compare_func, gm, delay_func, mainframe, column_graph);
+            break;
+        case LIST_SORT_TYPE_PARALLEL_RADIX:
+            Vector_sortParallelRadix(list, compare_func, gm, delay_func, mainframe, column_graph);
+            break;
+        case LIST_SORT_TYPE_CYCLE:
+            Vector_sortCycle(list, compare_func, gm, delay_func, mainframe, column_graph);
             break;
         default:
             log_message(LOG_LEVEL_WARN, "Unknown ListSortType: %d", sortType);
@@ -517,6 +1571,28 @@ const char* ListSortType_toString(ListSortType sortType) {
             return "Selection Sort";
         case LIST_SORT_TYPE_RADIX:
             return "Radix Sort";
+        case LIST_SORT_TYPE_HEAP:
+            return "Heap Sort";
+        case LIST_SORT_TYPE_HEAP_QUATERNARY:
+            return "4-ary Heap Sort";
+        case LIST_SORT_TYPE_SHELL:
+            return "Shell Sort";
+        case LIST_SORT_TYPE_COUNTING:
+            return "Counting Sort";
+        case LIST_SORT_TYPE_MSD_RADIX:
+            return "MSD Radix Sort";
+        case LIST_SORT_TYPE_MULTIKEY_QUICK:
+            return "Multikey Quick Sort";
+        case LIST_SORT_TYPE_BLOCK_MERGE:
+            return "Block Merge Sort";
+        case LIST_SORT_TYPE_SAMPLE:
+            return "Sample Sort";
+        case LIST_SORT_TYPE_PARALLEL_QUICK:
+            return "Parallel Quick Sort";
+        case LIST_SORT_TYPE_PARALLEL_RADIX:
+            return "Parallel Radix Sort";
+        case LIST_SORT_TYPE_CYCLE:
+            return "Cycle Sort";
         default:
             return "Unknown Sort Type";
     }
@@ -547,5 +1623,53 @@ ListSortType ListSortType_fromString(const char* str) {
     if (String_equals(str, "Radix Sort")) {
         return LIST_SORT_TYPE_RADIX;
     }
+    if (String_equals(str, "Heap Sort")) {
+        return LIST_SORT_TYPE_HEAP;
+    }
+    if (String_equals(str, "4-ary Heap Sort")) {
+        return LIST_SORT_TYPE_HEAP_QUATERNARY;
+    }
+    if (String_equals(str, "Shell Sort")) {
+        return LIST_SORT_TYPE_SHELL;
+    }
+    if (String_equals(str, "Counting Sort")) {
+        return LIST_SORT_TYPE_COUNTING;
+    }
+    if (String_equals(str, "MSD Radix Sort")) {
+        return LIST_SORT_TYPE_MSD_RADIX;
+    }
+    if (String_equals(str, "Multikey Quick Sort")) {
+        return LIST_SORT_TYPE_MULTIKEY_QUICK;
+    }
+    if (String_equals(str, "Block Merge Sort")) {
+        return LIST_SORT_TYPE_BLOCK_MERGE;
+    }
+    if (String_equals(str, "Sample Sort")) {
+        return LIST_SORT_TYPE_SAMPLE;
+    }
+    if (String_equals(str, "Parallel Quick Sort")) {
+        return LIST_SORT_TYPE_PARALLEL_QUICK;
+    }
+    if (String_equals(str, "Parallel Radix Sort")) {
+        return LIST_SORT_TYPE_PARALLEL_RADIX;
+    }
+    if (String_equals(str, "Cycle Sort")) {
+        return LIST_SORT_TYPE_CYCLE;
+    }
     return LIST_SORT_TYPE_COUNT;
 }
+
+const char* ShellGapSequence_toString(ShellGapSequence sequence) {
+    switch (sequence) {
+        case SHELL_GAPS_CIURA:
+            return "Ciura";
+        case SHELL_GAPS_TOKUDA:
+            return "Tokuda";
+        case SHELL_GAPS_SEDGEWICK:
+            return "Sedgewick";
+        case SHELL_GAPS_PRATT:
+            return "Pratt";
+        default:
+            return "Unknown";
+    }
+}
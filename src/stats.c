@@ -13,6 +13,7 @@ GraphStats* GraphStats_new() {
         error("Failed to allocate memory for GraphStats");
         return NULL;
     }
+    stats->write_cost = GRAPH_STATS_DEFAULT_WRITE_COST;
     return stats;
 }
 
@@ -28,6 +29,12 @@ void GraphStats_reset(GraphStats* stats) {
     stats->comparisons = 0;
     stats->swaps = 0;
     stats->access_memory = 0;
+    stats->reads = 0;
+    stats->writes = 0;
+    stats->char_comparisons = 0;
+    stats->aux_bytes = 0;
+    stats->peak_aux_bytes = 0;
+    stats->pass_count = 0;
 }
 
 void GraphStats_incrementComparisons(GraphStats* stats) {
@@ -40,11 +47,46 @@ void GraphStats_incrementSwaps(GraphStats* stats) {
     stats->swaps++;
 }
 
-void GraphStats_incrementAccessMemory(GraphStats* stats, int amount) {
+void GraphStats_incrementReads(GraphStats* stats, int amount) {
     if (!stats) return;
+    stats->reads += amount;
     stats->access_memory += amount;
 }
 
+void GraphStats_incrementWrites(GraphStats* stats, int amount) {
+    if (!stats) return;
+    stats->writes += amount;
+    stats->access_memory += amount;
+}
+
+void GraphStats_incrementCharComparisons(GraphStats* stats) {
+    if (!stats) return;
+    stats->char_comparisons++;
+}
+
+void GraphStats_allocAux(GraphStats* stats, size_t bytes) {
+    if (!stats) return;
+    stats->aux_bytes += bytes;
+    if (stats->aux_bytes > stats->peak_aux_bytes) {
+        stats->peak_aux_bytes = stats->aux_bytes;
+    }
+}
+
+void GraphStats_freeAux(GraphStats* stats, size_t bytes) {
+    if (!stats) return;
+    stats->aux_bytes = bytes < stats->aux_bytes ? stats->aux_bytes - bytes : 0;
+}
+
+void GraphStats_merge(GraphStats* into, const GraphStats* from) {
+    if (!into || !from) return;
+    into->comparisons += from->comparisons;
+    into->swaps += from->swaps;
+    into->access_memory += from->access_memory;
+    into->reads += from->reads;
+    into->writes += from->writes;
+    into->char_comparisons += from->char_comparisons;
+}
+
 Uint32 GraphStats_getSortTime(GraphStats* stats) {
     if (!stats) return 0;
     return stats->sort_time;
@@ -69,3 +111,70 @@ int GraphStats_getAccessMemory(GraphStats* stats) {
     if (!stats) return 0;
     return stats->access_memory;
 }
+
+int GraphStats_getReads(GraphStats* stats) {
+    if (!stats) return 0;
+    return stats->reads;
+}
+
+int GraphStats_getWrites(GraphStats* stats) {
+    if (!stats) return 0;
+    return stats->writes;
+}
+
+int GraphStats_getWriteCost(GraphStats* stats) {
+    if (!stats) return GRAPH_STATS_DEFAULT_WRITE_COST;
+    return stats->write_cost;
+}
+
+void GraphStats_setWriteCost(GraphStats* stats, int write_cost) {
+    if (!stats) return;
+    stats->write_cost = write_cost < 1 ? 1 : write_cost;
+}
+
+long GraphStats_getWeightedCost(GraphStats* stats) {
+    if (!stats) return 0;
+    return (long) stats->comparisons + stats->reads + (long) stats->write_cost * stats->writes;
+}
+
+int GraphStats_getCharComparisons(GraphStats* stats) {
+    if (!stats) return 0;
+    return stats->char_comparisons;
+}
+
+size_t GraphStats_getPeakAuxBytes(GraphStats* stats) {
+    if (!stats) return 0;
+    return stats->peak_aux_bytes;
+}
+
+void GraphStats_beginPass(GraphStats* stats, long gap) {
+    if (!stats || stats->pass_count >= GRAPH_STATS_MAX_PASSES) return;
+    // Holds the totals at the start of the pass until GraphStats_endPass turns them into deltas.
+    GraphStatsPass* pass = &stats->passes[stats->pass_count];
+    pass->gap = gap;
+    pass->comparisons = stats->comparisons;
+    pass->swaps = stats->swaps;
+    pass->access_memory = stats->access_memory;
+    pass->reads = stats->reads;
+    pass->writes = stats->writes;
+}
+
+void GraphStats_endPass(GraphStats* stats) {
+    if (!stats || stats->pass_count >= GRAPH_STATS_MAX_PASSES) return;
+    GraphStatsPass* pass = &stats->passes[stats->pass_count++];
+    pass->comparisons = stats->comparisons - pass->comparisons;
+    pass->swaps = stats->swaps - pass->swaps;
+    pass->access_memory = stats->access_memory - pass->access_memory;
+    pass->reads = stats->reads - pass->reads;
+    pass->writes = stats->writes - pass->writes;
+}
+
+int GraphStats_getPassCount(GraphStats* stats) {
+    if (!stats) return 0;
+    return stats->pass_count;
+}
+
+const GraphStatsPass* GraphStats_getPass(GraphStats* stats, int index) {
+    if (!stats || index < 0 || index >= stats->pass_count) return NULL;
+    return &stats->passes[index];
+}
@@ -48,6 +48,11 @@ static bool StringBuilder_ensure_capacity(StringBuilder* builder, size_t new_len
     return true;
 }
 
+bool StringBuilder_reserve(StringBuilder* builder, size_t capacity) {
+    if (!builder) return false;
+    return StringBuilder_ensure_capacity(builder, capacity);
+}
+
 void StringBuilder_append(StringBuilder* builder, const char* str) {
     if (!builder || !str) return;
     size_t str_len = strlen(str);
@@ -68,37 +73,40 @@ void StringBuilder_append_char(StringBuilder* builder, char c) {
 }
 
 void StringBuilder_append_int(StringBuilder* builder, int i) {
+    StringBuilder_append_long(builder, i);
+}
+
+void StringBuilder_append_long(StringBuilder* builder, long value) {
     if (!builder) return;
-    char buffer[32];
-    snprintf(buffer, sizeof(buffer), "%d", i);
-    StringBuilder_append(builder, buffer);
+    char digits[24];
+    size_t len = String_fromLong(digits, sizeof(digits), value);
+    if (!StringBuilder_ensure_capacity(builder, builder->length + len)) return;
+    memcpy(builder->data + builder->length, digits, len + 1);
+    builder->length += len;
 }
 
 void StringBuilder_append_format(StringBuilder* builder, const char* format, ...) {
     if (!builder || !format) return;
     va_list args;
     va_start(args, format);
-    char buffer[256];
-    int needed = vsnprintf(buffer, sizeof(buffer), format, args);
+    int needed = vsnprintf(builder->data + builder->length, builder->capacity - builder->length, format, args);
     va_end(args);
     if (needed < 0) {
         error("StringBuilder_append_format: vsnprintf error");
+        builder->data[builder->length] = '\0';
         return;
     }
-    if ((size_t)needed < sizeof(buffer)) {
-        StringBuilder_append(builder, buffer);
-    } else {
-        char* dynamic_buffer = malloc(needed + 1);
-        if (!dynamic_buffer) {
-            error("Failed to allocate memory for formatted string");
+    if (builder->length + needed >= builder->capacity) {
+        // Did not fit: grow once and format again in place.
+        if (!StringBuilder_ensure_capacity(builder, builder->length + needed)) {
+            builder->data[builder->length] = '\0';
             return;
         }
         va_start(args, format);
-        vsnprintf(dynamic_buffer, needed + 1, format, args);
+        vsnprintf(builder->data + builder->length, builder->capacity - builder->length, format, args);
         va_end(args);
-        StringBuilder_append(builder, dynamic_buffer);
-        safe_free((void**)&dynamic_buffer);
     }
+    builder->length += needed;
 }
 
 char* StringBuilder_build(StringBuilder* builder) {
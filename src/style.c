@@ -42,7 +42,7 @@ TextStyle* TextStyle_new(TTF_Font* font, int size, Color* color, int style) {
 
 void TextStyle_destroy(TextStyle* style) {
     if (!style) return;
-    safe_free((void**)&style->color);
+    Color_destroy(style->color);
     safe_free((void**)&style);
 }
 
@@ -67,7 +67,7 @@ TextStyle* TextStyle_defaultFromTheme(Theme* theme, ResourceManager* resource_ma
     }
     style->size = 32;
     style->font = ResourceManager_getDefaultFont(resource_manager, style->size);
-    style->color = theme->primary;
+    style->color = Color_copy(theme->primary);
     style->style = TTF_STYLE_NORMAL;
     return style;
 }
@@ -97,13 +97,13 @@ FullStyleColors* FullStyleColors_new(Color* background, Color* border, Color* te
 void FullStyleColors_destroy(FullStyleColors* colors) {
     if (!colors) return;
     if (colors->background) {
-        safe_free((void**)&colors->background);
+        Color_destroy(colors->background);
     }
     if (colors->border) {
-        safe_free((void**)&colors->border);
+        Color_destroy(colors->border);
     }
     if (colors->text) {
-        safe_free((void**)&colors->text);
+        Color_destroy(colors->text);
     }
     safe_free((void**)&colors);
 }
@@ -159,9 +159,9 @@ ButtonStyle* ButtonStyle_defaultFromTheme(Theme* theme, ResourceManager* resourc
     style->text_font = ResourceManager_getDefaultFont(resource_manager, style->text_size);
     style->text_style = TTF_STYLE_NORMAL;
     style->colors = FullStyleColors_new(
-        theme->secondary,
-        theme->primary,
-        theme->background);
+        Color_copy(theme->secondary),
+        Color_copy(theme->primary),
+        Color_copy(theme->background));
     style->paddings = EdgeInsets_newSymmetric(10, 20);
     return style;
 }
@@ -212,9 +212,9 @@ ButtonStyle* SelectStyle_defaultFromTheme(Theme* theme, ResourceManager* resourc
     style->text_font = ResourceManager_getDefaultFont(resource_manager, style->text_size);
     style->text_style = TTF_STYLE_NORMAL;
     style->colors = FullStyleColors_new(
-        theme->secondary,
-        theme->primary,
-        theme->background);
+        Color_copy(theme->secondary),
+        Color_copy(theme->primary),
+        Color_copy(theme->background));
     style->paddings = EdgeInsets_newSymmetric(10, 20);
     return style;
 }
@@ -264,9 +264,9 @@ InputBoxStyle* InputBoxStyle_defaultFromTheme(Theme* theme, ResourceManager* res
     style->font = ResourceManager_getDefaultFont(resource_manager, style->text_size);
     style->style = TTF_STYLE_NORMAL;
     style->colors = FullStyleColors_new(
-        theme->background,
-        theme->primary,
-        theme->primary);
+        Color_copy(theme->background),
+        Color_copy(theme->primary),
+        Color_copy(theme->primary));
     return style;
 }
 
@@ -287,9 +287,9 @@ Theme* Theme_new(Color* background, Color* primary, Color* secondary, TextStyle*
 
 void Theme_destroy(Theme* theme) {
     if (!theme) return;
-    safe_free((void**)&theme->background);
-    safe_free((void**)&theme->primary);
-    safe_free((void**)&theme->secondary);
+    Color_destroy(theme->background);
+    Color_destroy(theme->primary);
+    Color_destroy(theme->secondary);
     TextStyle_destroy(theme->title_style);
     TextStyle_destroy(theme->body_style);
     ButtonStyle_destroy(theme->button_style);
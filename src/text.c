@@ -18,6 +18,7 @@ Text* Text_new(SDL_Renderer* renderer, TextStyle* style, Position* position, boo
     }
     text->renderer = renderer;
     text->text = Strdup(str);
+    text->capacity = text->text ? strlen(text->text) + 1 : 0;
     text->style = style;
     text->position = position;
     text->fromCenter = fromCenter;
@@ -49,6 +50,7 @@ Text* Text_newf(SDL_Renderer* renderer, TextStyle* style, Position* position, bo
     } else {
         text->text = Strdup("");
     }
+    text->capacity = text->text ? strlen(text->text) + 1 : 0;
 
     refreshTexture(text);
 
@@ -72,8 +74,14 @@ void Text_setString(Text* self, const char* str) {
         return;
     }
 
-    safe_free((void**)&(self->text));
-    self->text = Strdup(str);
+    size_t length = strlen(str);
+    if (self->text && length < self->capacity) {
+        memmove(self->text, str, length + 1);
+    } else {
+        safe_free((void**)&(self->text));
+        self->text = Strdup(str);
+        self->capacity = self->text ? length + 1 : 0;
+    }
 
     refreshTexture(self);
 }
@@ -89,7 +97,11 @@ void Text_setStringf(Text* self, const char* format, ...) {
 }
 
 void Text_setColor(Text* self, Color* color) {
-    if (memcmp(&(self->style->color), color, sizeof(Color)) == 0) {
+    if (self->style->color && color && memcmp(self->style->color, color, sizeof(Color)) == 0) {
+        // Unchanged: keep the texture and drop the color we were given.
+        if (color != self->style->color) {
+            Color_destroy(color);
+        }
         return;
     }
 
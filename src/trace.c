@@ -0,0 +1,198 @@
+/*
+ * Copyright (c) 2025 Torisutan
+ * ALl rights reserved
+ */
+#include "trace.h"
+
+#include "logger.h"
+#include "parallel_sort.h"
+#include "utils.h"
+
+static_assert(TRACE_MAX_THREADS >= MAX_GRAPHS * PARALLEL_SORT_MAX_THREADS + MAX_GRAPHS + 1,
+              "TRACE_MAX_THREADS must cover every parallel sort thread");
+
+static TraceBuffer trace_buffers[TRACE_MAX_THREADS];
+static SDL_atomic_t trace_recording;
+static SDL_atomic_t trace_overflowed;
+static SDL_TLSID trace_tls;
+static Uint64 trace_origin;
+static TraceThreadName trace_names[TRACE_MAX_THREAD_NAMES];
+static int trace_name_count;
+static SDL_SpinLock trace_names_lock;
+
+static TraceBuffer* Trace_getBuffer();
+static void Trace_releaseBuffer(void* data);
+static void Trace_record(const char* name, char phase);
+static void Trace_writeString(FILE* file, const char* str);
+static void Trace_putName(SDL_threadID tid, const char* name);
+
+void Trace_start() {
+    if (!trace_tls) {
+        trace_tls = SDL_TLSCreate();
+        trace_origin = SDL_GetPerformanceCounter();
+    }
+    // No thread records while stopped (they check trace_recording first), the rings can be emptied.
+    SDL_AtomicLock(&trace_names_lock);
+    trace_name_count = 0;
+    SDL_AtomicUnlock(&trace_names_lock);
+    for (int i = 0; i < TRACE_MAX_THREADS; i++) {
+        TraceBuffer* buffer = &trace_buffers[i];
+        SDL_AtomicSet(&buffer->head, 0);
+        // Threads named during an earlier recording are still running under that name.
+        if (SDL_AtomicGet(&buffer->in_use) && buffer->name[0]) {
+            Trace_putName(buffer->tid, buffer->name);
+        }
+    }
+    SDL_AtomicSet(&trace_overflowed, 0);
+    SDL_AtomicSet(&trace_recording, 1);
+    log_message(LOG_LEVEL_INFO, "Trace recording started");
+}
+
+void Trace_stop() {
+    SDL_AtomicSet(&trace_recording, 0);
+    log_message(LOG_LEVEL_INFO, "Trace recording stopped");
+}
+
+bool Trace_isRecording() {
+    return SDL_AtomicGet(&trace_recording) != 0;
+}
+
+static TraceBuffer* Trace_getBuffer() {
+    TraceBuffer* buffer = SDL_TLSGet(trace_tls);
+    if (buffer) return buffer;
+    for (int i = 0; i < TRACE_MAX_THREADS; i++) {
+        TraceBuffer* candidate = &trace_buffers[i];
+        if (!SDL_AtomicCAS(&candidate->in_use, 0, 1)) continue;
+        // The buffer is ours from here, nobody else touches events or name.
+        if (!candidate->events) {
+            candidate->events = calloc(TRACE_BUFFER_EVENTS, sizeof(TraceEvent));
+            if (!candidate->events) {
+                error("Failed to allocate memory for TraceBuffer events");
+                SDL_AtomicSet(&candidate->in_use, 0);
+                return NULL;
+            }
+        }
+        candidate->tid = SDL_ThreadID();
+        candidate->name[0] = '\0';
+        SDL_TLSSet(trace_tls, candidate, Trace_releaseBuffer);
+        return candidate;
+    }
+    if (SDL_AtomicCAS(&trace_overflowed, 0, 1)) {
+        log_message(LOG_LEVEL_WARN, "More than %d threads are recording, the events of the others are lost",
+                    TRACE_MAX_THREADS);
+    }
+    return NULL;
+}
+
+static void Trace_releaseBuffer(void* data) {
+    TraceBuffer* buffer = data;
+    SDL_AtomicSet(&buffer->in_use, 0);
+}
+
+static void Trace_record(const char* name, char phase) {
+    TraceBuffer* buffer = Trace_getBuffer();
+    if (!buffer) return;
+    int head = SDL_AtomicGet(&buffer->head);
+    TraceEvent* event = &buffer->events[(unsigned int) head % TRACE_BUFFER_EVENTS];
+    event->name = name;
+    event->timestamp = SDL_GetPerformanceCounter();
+    event->tid = buffer->tid;
+    event->phase = phase;
+    // Publishing after the write: the dump never reads a slot that is being filled.
+    SDL_AtomicSet(&buffer->head, head + 1);
+}
+
+void Trace_begin(const char* name) {
+    if (!SDL_AtomicGet(&trace_recording)) return;
+    Trace_record(name, 'B');
+}
+
+void Trace_end(const char* name) {
+    if (!SDL_AtomicGet(&trace_recording)) return;
+    Trace_record(name, 'E');
+}
+
+void Trace_setThreadName(const char* format, ...) {
+    if (!SDL_AtomicGet(&trace_recording)) return;
+    TraceBuffer* buffer = Trace_getBuffer();
+    if (!buffer) return;
+    va_list args;
+    va_start(args, format);
+    vsnprintf(buffer->name, sizeof(buffer->name), format, args);
+    va_end(args);
+    Trace_putName(buffer->tid, buffer->name);
+}
+
+static void Trace_putName(SDL_threadID tid, const char* name) {
+    SDL_AtomicLock(&trace_names_lock);
+    int i = 0;
+    while (i < trace_name_count && trace_names[i].tid != tid) i++;
+    if (i < TRACE_MAX_THREAD_NAMES) {
+        trace_names[i].tid = tid;
+        snprintf(trace_names[i].name, sizeof(trace_names[i].name), "%s", name);
+        if (i == trace_name_count) trace_name_count++;
+    }
+    SDL_AtomicUnlock(&trace_names_lock);
+}
+
+static void Trace_writeString(FILE* file, const char* str) {
+    fputc('"', file);
+    for (const char* c = str; c && *c; c++) {
+        if (*c == '"' || *c == '\\') {
+            fputc('\\', file);
+        }
+        fputc(*c, file);
+    }
+    fputc('"', file);
+}
+
+bool Trace_dump(const char* path) {
+    FILE* file = fopen(path, "w");
+    if (!file) {
+        log_message(LOG_LEVEL_WARN, "Cannot open trace file %s", path);
+        return false;
+    }
+    double us_per_tick = 1000000.0 / (double) SDL_GetPerformanceFrequency();
+    size_t written = 0;
+    fputs("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n", file);
+    SDL_AtomicLock(&trace_names_lock);
+    for (int i = 0; i < trace_name_count; i++) {
+        fprintf(file, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%llu,\"args\":{\"name\":",
+                written++ ? ",\n" : "", (unsigned long long) trace_names[i].tid);
+        Trace_writeString(file, trace_names[i].name);
+        fputs("}}", file);
+    }
+    SDL_AtomicUnlock(&trace_names_lock);
+    for (int i = 0; i < TRACE_MAX_THREADS; i++) {
+        TraceBuffer* buffer = &trace_buffers[i];
+        if (!buffer->events) continue;
+        int head = SDL_AtomicGet(&buffer->head);
+        int count = head < TRACE_BUFFER_EVENTS ? head : TRACE_BUFFER_EVENTS;
+        for (int j = head - count; j < head; j++) {
+            TraceEvent* event = &buffer->events[(unsigned int) j % TRACE_BUFFER_EVENTS];
+            fprintf(file, "%s{\"name\":", written++ ? ",\n" : "");
+            Trace_writeString(file, event->name);
+            fprintf(file, ",\"ph\":\"%c\",\"ts\":%.3f,\"pid\":1,\"tid\":%llu}",
+                    event->phase, (double) (event->timestamp - trace_origin) * us_per_tick,
+                    (unsigned long long) event->tid);
+        }
+    }
+    fputs("\n]}\n", file);
+    bool ok = !ferror(file);
+    fclose(file);
+    if (ok) {
+        log_message(LOG_LEVEL_INFO, "Trace with %zu events written to %s", written, path);
+    } else {
+        log_message(LOG_LEVEL_WARN, "Failed to write trace file %s", path);
+    }
+    return ok;
+}
+
+void Trace_shutdown() {
+    SDL_AtomicSet(&trace_recording, 0);
+    for (int i = 0; i < TRACE_MAX_THREADS; i++) {
+        safe_free((void**)&trace_buffers[i].events);
+        SDL_AtomicSet(&trace_buffers[i].head, 0);
+    }
+    trace_name_count = 0;
+}
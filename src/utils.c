@@ -5,9 +5,14 @@
 #include "utils.h"
 #include "app.h"
 #include "logger.h"
+#include "pool.h"
+
+// Positions and colors are created and destroyed all the time by the UI, keep them in pools.
+static Pool position_pool = POOL_INITIALIZER(Position, 256);
+static Pool color_pool = POOL_INITIALIZER(Color, 256);
 
 Position* Position_new(const float x, const float y) {
-    Position* pos = calloc(1, sizeof(Position));
+    Position* pos = Pool_alloc(&position_pool);
     if (!pos) {
         error("Failed to allocate memory for Position");
         return NULL;
@@ -19,7 +24,7 @@ Position* Position_new(const float x, const float y) {
 
 void Position_destroy(Position* pos) {
     if (!pos) return;
-    safe_free((void**)&pos);
+    Pool_free(&position_pool, pos);
 }
 
 bool Position_equals(const Position* a, const Position* b) {
@@ -122,7 +127,7 @@ Color* Color_rgb(const int r, const int g, const int b) {
 }
 
 Color* Color_rgba(const int r, const int g, const int b, const int a) {
-    Color* color = (Color*)calloc(1, sizeof(Color));
+    Color* color = Pool_alloc(&color_pool);
     if (!color) {
         error("Failed to allocate memory for Color");
         return NULL;
@@ -164,7 +169,7 @@ Color* Color_hsv(float h, float s, float v) {
 
 void Color_destroy(Color* color) {
     if (!color) return;
-    safe_free((void**)&color);
+    Pool_free(&color_pool, color);
 }
 
 const char* Color_toHex(const Color* color) {
@@ -303,6 +308,45 @@ char* String_format(const char* fmt, ...) {
     return buffer;
 }
 
+int String_formatTo(char* buffer, size_t size, const char* fmt, ...) {
+    va_list args;
+    va_start(args, fmt);
+    int length = vsnprintf(buffer, size, fmt, args);
+    va_end(args);
+    return length;
+}
+
+// Copy src to the caller buffer with snprintf truncation rules.
+static size_t String_copyTo(char* buffer, size_t size, const char* src, size_t length) {
+    if (size > 0) {
+        size_t copied = length < size ? length : size - 1;
+        memcpy(buffer, src, copied);
+        buffer[copied] = '\0';
+    }
+    return length;
+}
+
+// Write the digits of value backwards, ending right before end. Returns the first digit.
+static char* String_writeDigits(char* end, unsigned long value) {
+    do {
+        *--end = (char) ('0' + value % 10);
+        value /= 10;
+    } while (value > 0);
+    return end;
+}
+
+size_t String_fromLong(char* buffer, size_t size, long value) {
+    char digits[24];
+    char* end = digits + sizeof(digits);
+    // Negating through unsigned keeps LONG_MIN well-defined.
+    unsigned long magnitude = value < 0 ? 0UL - (unsigned long) value : (unsigned long) value;
+    char* start = String_writeDigits(end, magnitude);
+    if (value < 0) {
+        *--start = '-';
+    }
+    return String_copyTo(buffer, size, start, end - start);
+}
+
 int modulo(const int a, const int b) {
     return ((a % b) + b) % b;
 }
@@ -371,40 +415,62 @@ int String_compare(const char* a, const char* b) {
 }
 
 char* String_formatTime(const Uint32 milliseconds) {
-    if (milliseconds == 0) {
-        return String_format("0s");
+    char buffer[32];
+    String_formatTimeTo(buffer, sizeof(buffer), milliseconds);
+    return Strdup(buffer);
+}
+
+// Append value followed by a unit suffix and an optional separating space.
+static char* String_appendUnit(char* out, Uint32 value, const char* unit, bool space) {
+    char digits[12];
+    char* end = digits + sizeof(digits);
+    char* start = String_writeDigits(end, value);
+    memcpy(out, start, end - start);
+    out += end - start;
+    while (*unit) {
+        *out++ = *unit++;
     }
+    if (space) {
+        *out++ = ' ';
+    }
+    return out;
+}
+
+size_t String_formatTimeTo(char* buffer, size_t size, const Uint32 milliseconds) {
+    char text[32];
+    char* out = text;
 
-    Uint32 total_ms = milliseconds;
-    Uint32 total_sec = total_ms / 1000;
-    Uint32 ms = total_ms % 1000;
+    Uint32 total_sec = milliseconds / 1000;
+    Uint32 ms = milliseconds % 1000;
     Uint32 hours = total_sec / 3600;
     Uint32 minutes = (total_sec % 3600) / 60;
     Uint32 seconds = total_sec % 60;
-    if (hours > 0) {
-        if (minutes > 0 && seconds > 0) {
-            return String_format("%uh %um %us", hours, minutes, seconds);
-        }
+    if (milliseconds == 0) {
+        out = String_appendUnit(out, 0, "s", false);
+    } else if (hours > 0) {
+        out = String_appendUnit(out, hours, "h", minutes > 0 || seconds > 0);
         if (minutes > 0) {
-            return String_format("%uh %um", hours, minutes);
+            out = String_appendUnit(out, minutes, "m", seconds > 0);
         }
         if (seconds > 0) {
-            return String_format("%uh %us", hours, seconds);
+            out = String_appendUnit(out, seconds, "s", false);
         }
-        return String_format("%uh", hours);
-    }
-    if (minutes > 0) {
+    } else if (minutes > 0) {
+        out = String_appendUnit(out, minutes, "m", seconds > 0);
         if (seconds > 0) {
-            return String_format("%um %us", minutes, seconds);
+            out = String_appendUnit(out, seconds, "s", false);
         }
-        return String_format("%um", minutes);
-    }
-    if (seconds <= 0) {
-        return String_format("%ums", ms);
-    }
-    float secf = seconds + (ms / 1000.0f);
-    if (secf < 0.01f) secf = 0.0f;
-    return String_format("%.2fs", secf);
+    } else if (seconds == 0) {
+        out = String_appendUnit(out, ms, "ms", false);
+    } else {
+        // Seconds with two decimals, rounded like "%.2f".
+        Uint32 hundredths = (seconds * 1000 + ms + 5) / 10;
+        out = String_appendUnit(out, hundredths / 100, ".", false);
+        *out++ = (char) ('0' + hundredths / 10 % 10);
+        *out++ = (char) ('0' + hundredths % 10);
+        *out++ = 's';
+    }
+    return String_copyTo(buffer, size, text, out - text);
 }
 
 int* voidToIntArray(void** arr, int len) {
@@ -0,0 +1,251 @@
+/*
+ * Copyright (c) 2025 Torisutan
+ * ALl rights reserved
+ */
+#include "vector.h"
+#include "logger.h"
+#include "random.h"
+#include "utils.h"
+
+static bool Vector_grow(Vector* vector, size_t min_capacity);
+
+Vector* Vector_create() {
+    return Vector_createWithCapacity(VECTOR_DEFAULT_CAPACITY);
+}
+
+Vector* Vector_createWithCapacity(size_t capacity) {
+    Vector* vector = calloc(1, sizeof(Vector));
+    if (!vector) {
+        error("Failed to allocate memory for Vector");
+        return NULL;
+    }
+    if (capacity == 0) capacity = VECTOR_DEFAULT_CAPACITY;
+    vector->data = malloc(capacity * sizeof(void*));
+    if (!vector->data) {
+        error("Failed to allocate memory for Vector data");
+        safe_free((void**)&vector);
+        return NULL;
+    }
+    vector->capacity = capacity;
+    vector->size = 0;
+    return vector;
+}
+
+void Vector_destroy(Vector* vector) {
+    if (!vector) return;
+    safe_free((void**)&vector->data);
+    safe_free((void**)&vector);
+}
+
+void Vector_destroyWithValues(Vector* vector, DestroyFunc destroy_func) {
+    if (!vector) return;
+    if (destroy_func) {
+        for (size_t i = 0; i < vector->size; i++) {
+            destroy_func(vector->data[i]);
+        }
+    }
+    Vector_destroy(vector);
+}
+
+void Vector_clear(Vector* vector) {
+    if (!vector) return;
+    vector->size = 0;
+}
+
+static bool Vector_grow(Vector* vector, size_t min_capacity) {
+    size_t capacity = vector->capacity ? vector->capacity : VECTOR_DEFAULT_CAPACITY;
+    while (capacity < min_capacity) {
+        capacity += capacity / 2 + 1;
+    }
+    void** data = realloc(vector->data, capacity * sizeof(void*));
+    if (!data) {
+        error("Failed to grow Vector to %zu elements", capacity);
+        return false;
+    }
+    vector->data = data;
+    vector->capacity = capacity;
+    return true;
+}
+
+bool Vector_reserve(Vector* vector, size_t capacity) {
+    if (!vector) return false;
+    if (capacity <= vector->capacity) return true;
+    return Vector_grow(vector, capacity);
+}
+
+void Vector_push(Vector* vector, void* value) {
+    if (vector->size == vector->capacity && !Vector_grow(vector, vector->size + 1)) {
+        return;
+    }
+    vector->data[vector->size++] = value;
+}
+
+void Vector_remove(Vector* vector, void* value) {
+    long index = Vector_indexOf(vector, value);
+    if (index < 0) return;
+    Vector_pop(vector, (size_t) index);
+}
+
+void* Vector_pop(Vector* vector, size_t index) {
+    if (index >= vector->size) {
+        error("Index out of bounds");
+        return NULL;
+    }
+    void* value = vector->data[index];
+    memmove(&vector->data[index], &vector->data[index + 1], (vector->size - index - 1) * sizeof(void*));
+    vector->size--;
+    return value;
+}
+
+void* Vector_swapRemove(Vector* vector, size_t index) {
+    if (index >= vector->size) {
+        error("Index out of bounds");
+        return NULL;
+    }
+    void* value = vector->data[index];
+    vector->data[index] = vector->data[--vector->size];
+    return value;
+}
+
+size_t Vector_size(Vector* vector) {
+    return vector->size;
+}
+
+bool Vector_empty(Vector* vector) {
+    return vector->size == 0;
+}
+
+bool Vector_contains(Vector* vector, void* value, bool isString) {
+    for (size_t i = 0; i < vector->size; i++) {
+        if (isString ? String_equals(vector->data[i], value) : vector->data[i] == value) {
+            return true;
+        }
+    }
+    return false;
+}
+
+long Vector_indexOf(Vector* vector, void* value) {
+    for (size_t i = 0; i < vector->size; i++) {
+        if (vector->data[i] == value) {
+            return (long) i;
+        }
+    }
+    return -1;
+}
+
+void* Vector_get(Vector* vector, size_t index) {
+    if (index >= vector->size) {
+        error("Index out of bounds");
+        return NULL;
+    }
+    return vector->data[index];
+}
+
+void* Vector_getLast(Vector* vector) {
+    if (vector->size == 0) {
+        error("Vector is empty");
+        return NULL;
+    }
+    return vector->data[vector->size - 1];
+}
+
+void* Vector_getFirst(Vector* vector) {
+    if (vector->size == 0) {
+        error("Vector is empty");
+        return NULL;
+    }
+    return vector->data[0];
+}
+
+void Vector_set(Vector* vector, size_t index, void* value) {
+    if (index >= vector->size) {
+        error("Index out of bounds");
+        return;
+    }
+    vector->data[index] = value;
+}
+
+void Vector_swap(Vector* vector, size_t index1, size_t index2) {
+    if (!vector || index1 >= vector->size || index2 >= vector->size) {
+        error("Index out of bounds in Vector_swap");
+        return;
+    }
+    void* temp = vector->data[index1];
+    vector->data[index1] = vector->data[index2];
+    vector->data[index2] = temp;
+}
+
+void Vector_shuffle(Vector* vector, PRNG* pr) {
+    if (!vector || vector->size < 2) return;
+
+    for (size_t i = vector->size - 1; i > 0; i--) {
+        size_t j = (pr == NULL ? (Uint32) rand() : PRNG_next(pr)) % (i + 1);
+        void* temp = vector->data[i];
+        vector->data[i] = vector->data[j];
+        vector->data[j] = temp;
+    }
+}
+
+void* Vector_max(Vector* vector, CompareFunc compare_func) {
+    if (!vector || vector->size == 0) {
+        error("Vector is empty in Vector_max");
+        return NULL;
+    }
+    void* max_value = vector->data[0];
+    for (size_t i = 1; i < vector->size; i++) {
+        if (compare_func(max_value, vector->data[i]) < 0) {
+            max_value = vector->data[i];
+        }
+    }
+    return max_value;
+}
+
+void* Vector_min(Vector* vector, CompareFunc compare_func) {
+    if (!vector || vector->size == 0) {
+        error("Vector is empty in Vector_min");
+        return NULL;
+    }
+    void* min_value = vector->data[0];
+    for (size_t i = 1; i < vector->size; i++) {
+        if (compare_func(min_value, vector->data[i]) > 0) {
+            min_value = vector->data[i];
+        }
+    }
+    return min_value;
+}
+
+VectorIterator* VectorIterator_new(Vector* vector) {
+    VectorIterator* iterator = calloc(1, sizeof(VectorIterator));
+    if (!iterator) {
+        error("Failed to allocate memory for VectorIterator");
+        return NULL;
+    }
+    iterator->vector = vector;
+    iterator->current = 0;
+    iterator->index = 0;
+    iterator->size = vector->size;
+    return iterator;
+}
+
+void VectorIterator_destroy(VectorIterator* iterator) {
+    if (!iterator) return;
+    safe_free((void**)&iterator);
+}
+
+bool VectorIterator_hasNext(VectorIterator* iterator) {
+    return iterator->current < iterator->size && iterator->current < iterator->vector->size;
+}
+
+void* VectorIterator_next(VectorIterator* iterator) {
+    if (!VectorIterator_hasNext(iterator)) {
+        error("No more elements in VectorIterator");
+        return NULL;
+    }
+    void* value = iterator->vector->data[iterator->current++];
+    iterator->index++;
+    return value;
+}
+
+int VectorIterator_index(VectorIterator* iterator) {
+    return iterator->index - 1;
+}